@@ -31,9 +31,11 @@
 
 #include <QtCharts/QXYSeries>
 
+// The device feeds the series through a producer, so it works the same no matter which
+// thread the audio input writes to it from. The series picks up the samples once per frame.
 XYSeriesIODevice::XYSeriesIODevice(QXYSeries *series, QObject *parent) :
     QIODevice(parent),
-    m_series(series)
+    m_producer(series->producer())
 {
 }
 
@@ -65,6 +67,6 @@ qint64 XYSeriesIODevice::writeData(const char *data, qint64 maxSize)
     for (int s = start; s < sampleCount; ++s, data += resolution)
         m_buffer[s].setY(qreal(uchar(*data) -128) / qreal(128));
 
-    m_series->replace(m_buffer);
+    m_producer.replace(m_buffer);
     return (sampleCount - start) * resolution;
 }
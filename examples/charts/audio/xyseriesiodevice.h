@@ -34,6 +34,7 @@
 #include <QtCore/QPointF>
 #include <QtCore/QList>
 #include <QtCharts/QChartGlobal>
+#include <QtCharts/QXYSeriesProducer>
 
 QT_BEGIN_NAMESPACE
 class QXYSeries;
@@ -54,7 +55,7 @@ protected:
     qint64 writeData(const char *data, qint64 maxSize) override;
 
 private:
-    QXYSeries *m_series;
+    QXYSeriesProducer m_producer;
     QList<QPointF> m_buffer;
 };
 
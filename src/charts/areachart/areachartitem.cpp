@@ -34,6 +34,9 @@
 #include <private/chartpresenter_p.h>
 #include <private/abstractdomain_p.h>
 #include <private/chartdataset_p.h>
+#include <private/xyclipper_p.h>
+#include <QtCore/QtMath>
+#include <algorithm>
 #include <QtGui/QPainter>
 #include <QtWidgets/QGraphicsSceneMouseEvent>
 #include <QtCore/QDebug>
@@ -135,8 +138,14 @@ QRectF AreaChartItem::boundingRect() const
     return m_rect;
 }
 
+// Cartesian areas are painted from the fill polygon, the path is only created when
+// something asks for the shape.
 QPainterPath AreaChartItem::shape() const
 {
+    if (m_path.isEmpty() && !m_fillPolygon.isEmpty()) {
+        m_path.addPolygon(m_fillPolygon);
+        m_path.closeSubpath();
+    }
     return m_path;
 }
 
@@ -145,6 +154,11 @@ void AreaChartItem::updatePath()
     QPainterPath path;
     QRectF rect(QPointF(0,0),domain()->size());
 
+    if (m_upper && presenter()->chartType() == QChart::ChartTypeCartesian) {
+        updatePolygon(rect);
+        return;
+    }
+
     if (m_upper) {
         path = m_upper->path();
 
@@ -162,14 +176,7 @@ void AreaChartItem::updatePath()
             // separately.
             path.connectPath(m_lower->path().toReversed());
         } else {
-            QPointF first = path.pointAtPercent(0);
-            QPointF last =  path.pointAtPercent(1);
-            if (presenter()->chartType() == QChart::ChartTypeCartesian) {
-                path.lineTo(last.x(), rect.bottom());
-                path.lineTo(first.x(), rect.bottom());
-            } else { // polar
-                path.lineTo(rect.center());
-            }
+            path.lineTo(rect.center());
         }
         path.closeSubpath();
     }
@@ -179,12 +186,49 @@ void AreaChartItem::updatePath()
     if (path.boundingRect().height() <= INT_MAX
             && path.boundingRect().width() <= INT_MAX) {
         prepareGeometryChange();
+        m_fillPolygon = QPolygonF();
         m_path = path;
         m_rect = path.boundingRect();
         update();
     }
 }
 
+// Builds the fill polygon of a cartesian area directly from the points of the edge lines,
+// in one pass into a buffer that is kept between the updates. The area is built from the
+// unclipped lines and then cut to the plot area, with a margin for the pen, so that zooming
+// in deeply does not create huge polygons.
+void AreaChartItem::updatePolygon(const QRectF &rect)
+{
+    const QList<QPointF> &upperPoints = m_upper->linePoints();
+    const QList<QPointF> lowerPoints = m_lower ? m_lower->linePoints() : QList<QPointF>();
+
+    // Release the previous result, which may share the buffer
+    m_fillPolygon = QPolygonF();
+    int size = upperPoints.size() + lowerPoints.size();
+    if (!m_lower && !upperPoints.isEmpty())
+        size += 2;
+    m_polygon.resize(size);
+
+    QPointF *out = std::copy(upperPoints.cbegin(), upperPoints.cend(), m_polygon.data());
+    if (m_lower) {
+        std::reverse_copy(lowerPoints.cbegin(), lowerPoints.cend(), out);
+    } else if (!upperPoints.isEmpty()) {
+        *out++ = QPointF(upperPoints.last().x(), rect.bottom());
+        *out = QPointF(upperPoints.first().x(), rect.bottom());
+    }
+
+    const qreal margin = qMax(m_linePen.widthF(), qreal(1.0))
+            * qMax(qreal(M_SQRT2), m_linePen.miterLimit()) + 1.0;
+    const QPolygonF polygon = XYClipper::clipPolygon(m_polygon, rect.adjusted(-margin, -margin,
+                                                                              margin, margin));
+
+    prepareGeometryChange();
+    m_fillPolygon = polygon;
+    m_path = QPainterPath();
+    m_rect = m_fillPolygon.boundingRect();
+    update();
+}
+
 void AreaChartItem::handleUpdated()
 {
     setVisible(m_series->isVisible());
@@ -246,7 +290,10 @@ void AreaChartItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *opt
     else
         painter->setClipRect(clipRect);
 
-    painter->drawPath(m_path);
+    if (m_fillPolygon.isEmpty())
+        painter->drawPath(m_path);
+    else
+        painter->drawPolygon(m_fillPolygon);
     if (m_pointsVisible) {
         painter->setPen(m_pointPen);
         if (m_upper)
@@ -275,7 +322,11 @@ void AreaChartItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *opt
         QString pointLabel;
 
         if (m_series->upperSeries()) {
-            for (int i(0); i < m_series->upperSeries()->count(); i++) {
+            // The geometry may only cover a part of the series
+            const QList<QPointF> geometry = m_upper->geometryPoints();
+            const int first = m_upper->geometryOffset();
+            const int end = qMin(first + int(geometry.size()), m_series->upperSeries()->count());
+            for (int i(first); i < end; i++) {
                 pointLabel = m_pointLabelsFormat;
                 pointLabel.replace(xPointTag,
                                    presenter()->numberToString(m_series->upperSeries()->at(i).x()));
@@ -284,7 +335,7 @@ void AreaChartItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *opt
 
                 // Position text in relation to the point
                 int pointLabelWidth = fm.horizontalAdvance(pointLabel);
-                QPointF position(m_upper->geometryPoints().at(i));
+                QPointF position(geometry.at(i - first));
                 position.setX(position.x() - pointLabelWidth / 2);
                 position.setY(position.y() - m_series->upperSeries()->pen().width() / 2
                               - labelOffset);
@@ -293,7 +344,11 @@ void AreaChartItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *opt
         }
 
         if (m_series->lowerSeries()) {
-            for (int i(0); i < m_series->lowerSeries()->count(); i++) {
+            // The geometry may only cover a part of the series
+            const QList<QPointF> geometry = m_lower->geometryPoints();
+            const int first = m_lower->geometryOffset();
+            const int end = qMin(first + int(geometry.size()), m_series->lowerSeries()->count());
+            for (int i(first); i < end; i++) {
                 pointLabel = m_pointLabelsFormat;
                 pointLabel.replace(xPointTag,
                                    presenter()->numberToString(m_series->lowerSeries()->at(i).x()));
@@ -302,7 +357,7 @@ void AreaChartItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *opt
 
                 // Position text in relation to the point
                 int pointLabelWidth = fm.horizontalAdvance(pointLabel);
-                QPointF position(m_lower->geometryPoints().at(i));
+                QPointF position(geometry.at(i - first));
                 position.setX(position.x() - pointLabelWidth / 2);
                 position.setY(position.y() - m_series->lowerSeries()->pen().width() / 2
                               - labelOffset);
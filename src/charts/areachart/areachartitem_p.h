@@ -92,11 +92,14 @@ public Q_SLOTS:
 
 private:
     void fixEdgeSeriesDomain(LineChartItem *edgeSeries);
+    void updatePolygon(const QRectF &rect);
 
     QAreaSeries *m_series;
     LineChartItem *m_upper;
     LineChartItem *m_lower;
-    QPainterPath m_path;
+    mutable QPainterPath m_path;
+    QPolygonF m_polygon;
+    QPolygonF m_fillPolygon;
     QRectF m_rect;
     QPen m_linePen;
     QPen m_pointPen;
@@ -136,6 +139,7 @@ public:
             // Component lineseries are not necessarily themselves on the chart,
             // so get the chart type for them from area chart.
             forceChartType(m_item->series()->chart()->chartType());
+            suppressLine();
             LineChartItem::updateGeometry();
             m_item->updatePath();
         }
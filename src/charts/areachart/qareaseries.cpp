@@ -37,6 +37,7 @@
 #include <QtCharts/QValueAxis>
 #include <QtCharts/QAreaLegendMarker>
 #include <private/qchart_p.h>
+#include <private/qxyseries_p.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -697,47 +698,28 @@ void QAreaSeriesPrivate::initializeDomain()
     qreal maxX(1.0);
     qreal maxY(1.0);
 
-    QLineSeries *upperSeries = q->upperSeries();
-    QLineSeries *lowerSeries = q->lowerSeries();
-
-    if (upperSeries) {
-        const auto &points = upperSeries->points();
-
-        if (!points.isEmpty()) {
-            minX = points[0].x();
-            minY = points[0].y();
-            maxX = minX;
-            maxY = minY;
-
-            for (int i = 0; i < points.count(); i++) {
-                qreal x = points[i].x();
-                qreal y = points[i].y();
-                minX = qMin(minX, x);
-                minY = qMin(minY, y);
-                maxX = qMax(maxX, x);
-                maxY = qMax(maxY, y);
-            }
-        }
-    }
-    if (lowerSeries) {
-        const auto &points = lowerSeries->points();
-
-        if (!points.isEmpty()) {
-            if (!upperSeries) {
-                minX = points[0].x();
-                minY = points[0].y();
-                maxX = minX;
-                maxY = minY;
-            }
-
-            for (int i = 0; i < points.count(); i++) {
-                qreal x = points[i].x();
-                qreal y = points[i].y();
-                minX = qMin(minX, x);
-                minY = qMin(minY, y);
-                maxX = qMax(maxX, x);
-                maxY = qMax(maxY, y);
-            }
+    QXYSeries *upperSeries = q->upperSeries();
+    QXYSeries *lowerSeries = q->lowerSeries();
+
+    bool upperBounds = false;
+    if (upperSeries)
+        upperBounds = upperSeries->d_func()->bounds(minX, maxX, minY, maxY);
+
+    qreal lowerMinX;
+    qreal lowerMaxX;
+    qreal lowerMinY;
+    qreal lowerMaxY;
+    if (lowerSeries && lowerSeries->d_func()->bounds(lowerMinX, lowerMaxX, lowerMinY, lowerMaxY)) {
+        if (upperBounds) {
+            minX = qMin(minX, lowerMinX);
+            maxX = qMax(maxX, lowerMaxX);
+            minY = qMin(minY, lowerMinY);
+            maxY = qMax(maxY, lowerMaxY);
+        } else {
+            minX = lowerMinX;
+            maxX = lowerMaxX;
+            minY = lowerMinY;
+            maxY = lowerMaxY;
         }
     }
 
@@ -0,0 +1,324 @@
+/****************************************************************************
+**
+** Copyright (C) 2021 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtCharts/QAreaSeriesStack>
+#include <QtCharts/QAreaSeries>
+#include <QtCharts/QLineSeries>
+#include <private/qareaseriesstack_p.h>
+#include <private/qxyseries_p.h>
+#include <QtCore/QDebug>
+#include <algorithm>
+#include <cstring>
+
+#if defined(__SSE2__) && !defined(QT_COORD_TYPE)
+#  define QAREASERIESSTACK_SSE2
+#  include <immintrin.h>
+#endif
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QAreaSeriesStack
+    \inmodule QtCharts
+    \brief The QAreaSeriesStack class stacks area series on top of each other.
+    \since 6.2
+
+    A stack has a fixed number of bands, which are area series that share the same x
+    values. The values of a band are added on top of the values of the bands below it,
+    so that the top of the topmost band is the total of all the bands. The bands are
+    added to a chart like any other area series:
+
+    \code
+    QAreaSeriesStack *stack = new QAreaSeriesStack(3, chart);
+    stack->replace(timestamps, { cpuUser, cpuSystem, cpuIdle });
+    for (QAreaSeries *band : stack->bands())
+        chart->addSeries(band);
+    \endcode
+
+    Building the same chart from area series whose edges are separate line series
+    stores each edge twice and sums the values of the bands separately for each of them.
+    The stack instead keeps the x values and all the cumulative sums in a single buffer,
+    and its line series read the buffer without copying it. The top edge of a band is
+    the bottom edge of the band above it, and the bottom edge of the first band is zero.
+    Appending a row of values only calculates the sums of the new row, and the line
+    series only report the new row as added.
+
+    The line series of the stack are owned by it and must not be modified directly.
+    Destroying the stack also destroys its bands.
+
+    \sa QAreaSeries
+*/
+
+QAreaSeriesStackPrivate::QAreaSeriesStackPrivate(QAreaSeriesStack *q, int bandCount)
+    : q_ptr(q),
+      m_bandCount(qMax(1, bandCount)),
+      m_count(0),
+      m_capacity(0),
+      m_buffer(new QList<qreal>)
+{
+}
+
+bool QAreaSeriesStackPrivate::checkValues(const QList<qreal> &x,
+                                          const QList<QList<qreal>> &values) const
+{
+    if (values.count() != m_bandCount) {
+        qWarning("QAreaSeriesStack: Expected values for %d bands, got %d",
+                 m_bandCount, int(values.count()));
+        return false;
+    }
+    for (const QList<qreal> &bandValues : values) {
+        if (bandValues.count() != x.count()) {
+            qWarning("QAreaSeriesStack: Expected %d values for each band, got %d",
+                     int(x.count()), int(bandValues.count()));
+            return false;
+        }
+    }
+    return true;
+}
+
+// Grows the buffer to fit at least count rows. The series keep the old buffer alive
+// until they adopt the new one.
+void QAreaSeriesStackPrivate::reserve(int count)
+{
+    if (count <= m_capacity)
+        return;
+
+    const int capacity = qMax(qMax(count, 2 * m_capacity), int(MinimumCapacity));
+    QSharedPointer<QList<qreal>> buffer(new QList<qreal>(qsizetype(capacity)
+                                                         * (m_bandCount + 2)));
+    for (int i = 0; m_count > 0 && i < m_bandCount + 2; ++i) {
+        std::memcpy(buffer->data() + qsizetype(i) * capacity, column(i),
+                    m_count * sizeof(qreal));
+    }
+    m_buffer = buffer;
+    m_capacity = capacity;
+}
+
+// Writes the rows after the current ones, the sums are calculated column by column
+void QAreaSeriesStackPrivate::appendRows(const QList<qreal> &x,
+                                         const QList<QList<qreal>> &values)
+{
+    const int count = int(x.count());
+    if (count == 0)
+        return;
+    reserve(m_count + count);
+    std::memcpy(column(0) + m_count, x.constData(), count * sizeof(qreal));
+    std::fill_n(column(1) + m_count, count, qreal(0));
+    for (int i = 0; i < m_bandCount; ++i)
+        add(column(i + 2) + m_count, column(i + 1) + m_count, values.at(i).constData(), count);
+    m_count += count;
+}
+
+void QAreaSeriesStackPrivate::adoptColumns()
+{
+    const qreal *x = column(0);
+    for (int i = 0; i < m_boundaries.count(); ++i) {
+        // The buffer stays alive until the series releases the columns
+        m_boundaries.at(i)->adoptColumns(x, column(i + 1), m_count,
+                                         [buffer = m_buffer]() mutable { buffer.reset(); });
+    }
+}
+
+// Lets the boundaries know about the rows appended since they last adopted the columns,
+// without going through all of their points again
+void QAreaSeriesStackPrivate::appendColumns()
+{
+    const qreal *x = column(0);
+    for (int i = 0; i < m_boundaries.count(); ++i) {
+        QXYSeries *boundary = m_boundaries.at(i);
+        boundary->d_func()->appendColumns(x, column(i + 1), m_count,
+                                          [buffer = m_buffer]() mutable { buffer.reset(); });
+    }
+}
+
+void QAreaSeriesStackPrivate::add(qreal *out, const qreal *a, const qreal *b, qsizetype count)
+{
+    qsizetype i = 0;
+#ifdef QAREASERIESSTACK_SSE2
+    for (; i + 2 <= count; i += 2)
+        _mm_storeu_pd(out + i, _mm_add_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i)));
+#endif
+    for (; i < count; ++i)
+        out[i] = a[i] + b[i];
+}
+
+/*!
+    Constructs a stack of \a bandCount bands, without any values, with the \a parent
+    object. A stack has at least one band.
+*/
+QAreaSeriesStack::QAreaSeriesStack(int bandCount, QObject *parent)
+    : QObject(parent),
+      d_ptr(new QAreaSeriesStackPrivate(this, bandCount))
+{
+    Q_D(QAreaSeriesStack);
+    for (int i = 0; i <= d->m_bandCount; ++i)
+        d->m_boundaries.append(new QLineSeries(this));
+    for (int i = 0; i < d->m_bandCount; ++i) {
+        QAreaSeries *band = new QAreaSeries(this);
+        band->setUpperSeries(d->m_boundaries.at(i + 1));
+        band->setLowerSeries(d->m_boundaries.at(i));
+        d->m_bands.append(band);
+    }
+}
+
+/*!
+    Destroys the stack and its bands.
+*/
+QAreaSeriesStack::~QAreaSeriesStack()
+{
+    Q_D(QAreaSeriesStack);
+    // The bands use the boundaries, and they may have been moved to a chart
+    for (const QPointer<QAreaSeries> &band : qAsConst(d->m_bands))
+        delete band.data();
+    delete d_ptr;
+}
+
+/*!
+    Returns the number of bands in the stack.
+*/
+int QAreaSeriesStack::bandCount() const
+{
+    Q_D(const QAreaSeriesStack);
+    return d->m_bandCount;
+}
+
+/*!
+    Returns the band at \a index, counted from the bottom of the stack, or \nullptr if
+    the index is out of range or the band has been destroyed.
+*/
+QAreaSeries *QAreaSeriesStack::band(int index) const
+{
+    Q_D(const QAreaSeriesStack);
+    if (index < 0 || index >= d->m_bands.count())
+        return nullptr;
+    return d->m_bands.at(index).data();
+}
+
+/*!
+    Returns the bands of the stack, from the bottom to the top.
+*/
+QList<QAreaSeries *> QAreaSeriesStack::bands() const
+{
+    Q_D(const QAreaSeriesStack);
+    QList<QAreaSeries *> bands;
+    for (const QPointer<QAreaSeries> &band : d->m_bands) {
+        if (band)
+            bands.append(band.data());
+    }
+    return bands;
+}
+
+/*!
+    Returns the line series of the boundary at \a index. The boundary 0 is the zero
+    baseline, and the boundary \c n is the top of the band \c{n - 1}. Returns \nullptr
+    if the index is out of range.
+*/
+QLineSeries *QAreaSeriesStack::boundary(int index) const
+{
+    Q_D(const QAreaSeriesStack);
+    if (index < 0 || index >= d->m_boundaries.count())
+        return nullptr;
+    return d->m_boundaries.at(index);
+}
+
+/*!
+    Returns the number of x values in the stack.
+*/
+int QAreaSeriesStack::count() const
+{
+    Q_D(const QAreaSeriesStack);
+    return d->m_count;
+}
+
+/*!
+    Replaces the values of the stack with the x values \a x and the \a values of the
+    bands. The \a values contain a list for each band, from the bottom to the top,
+    with a value for each x value.
+*/
+void QAreaSeriesStack::replace(const QList<qreal> &x, const QList<QList<qreal>> &values)
+{
+    Q_D(QAreaSeriesStack);
+    if (!d->checkValues(x, values))
+        return;
+    d->m_count = 0;
+    d->appendRows(x, values);
+    d->adoptColumns();
+}
+
+/*!
+    Appends the x value \a x with the \a values of the bands, from the bottom to the top.
+    The boundaries emit QXYSeries::pointsAdded() for the new point.
+*/
+void QAreaSeriesStack::append(qreal x, const QList<qreal> &values)
+{
+    Q_D(QAreaSeriesStack);
+    if (values.count() != d->m_bandCount) {
+        qWarning("QAreaSeriesStack: Expected values for %d bands, got %d",
+                 d->m_bandCount, int(values.count()));
+        return;
+    }
+    d->reserve(d->m_count + 1);
+    d->column(0)[d->m_count] = x;
+    qreal sum = 0;
+    d->column(1)[d->m_count] = sum;
+    for (int i = 0; i < d->m_bandCount; ++i) {
+        sum += values.at(i);
+        d->column(i + 2)[d->m_count] = sum;
+    }
+    ++d->m_count;
+    d->appendColumns();
+}
+
+/*!
+    Appends the x values \a x with the \a values of the bands. The \a values contain a
+    list for each band, from the bottom to the top, with a value for each x value.
+    The boundaries emit QXYSeries::pointsAdded() for the new points.
+*/
+void QAreaSeriesStack::append(const QList<qreal> &x, const QList<QList<qreal>> &values)
+{
+    Q_D(QAreaSeriesStack);
+    if (!d->checkValues(x, values))
+        return;
+    d->appendRows(x, values);
+    d->appendColumns();
+}
+
+/*!
+    Removes all the values from the stack.
+*/
+void QAreaSeriesStack::clear()
+{
+    Q_D(QAreaSeriesStack);
+    d->m_count = 0;
+    d->adoptColumns();
+}
+
+QT_END_NAMESPACE
+
+#include "moc_qareaseriesstack.cpp"
@@ -0,0 +1,88 @@
+/****************************************************************************
+**
+** Copyright (C) 2021 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt Chart API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+
+#ifndef QAREASERIESSTACK_P_H
+#define QAREASERIESSTACK_P_H
+
+#include <QtCharts/QAreaSeriesStack>
+#include <QtCharts/private/qchartglobal_p.h>
+#include <QtCore/QList>
+#include <QtCore/QPointer>
+#include <QtCore/QSharedPointer>
+
+QT_BEGIN_NAMESPACE
+
+// The x values and the boundaries of all the bands are kept in one buffer, one column
+// after the other. Column 0 holds the x values, column 1 the zero baseline and column
+// k + 1 the top of band k, which is the sum of the values of bands 0 to k. The boundary
+// series adopt the columns without copying them. When the buffer grows, the boundaries
+// adopt the new buffer and the old one is freed once no series uses it anymore. Appended
+// rows are written after the rows the series already use, so that the series only need
+// to be told about the new rows.
+class Q_CHARTS_PRIVATE_EXPORT QAreaSeriesStackPrivate
+{
+public:
+    QAreaSeriesStackPrivate(QAreaSeriesStack *q, int bandCount);
+
+    bool checkValues(const QList<qreal> &x, const QList<QList<qreal>> &values) const;
+    void reserve(int count);
+    void appendRows(const QList<qreal> &x, const QList<QList<qreal>> &values);
+    void adoptColumns();
+    void appendColumns();
+    qreal *column(int index) const { return m_buffer->data() + qsizetype(index) * m_capacity; }
+
+    // out[i] = a[i] + b[i]
+    static void add(qreal *out, const qreal *a, const qreal *b, qsizetype count);
+
+    static const int MinimumCapacity = 64;
+
+    QAreaSeriesStack *q_ptr;
+    int m_bandCount;
+    int m_count;
+    int m_capacity;
+    QSharedPointer<QList<qreal>> m_buffer;
+    QList<QLineSeries *> m_boundaries;
+    QList<QPointer<QAreaSeries>> m_bands;
+
+private:
+    Q_DECLARE_PUBLIC(QAreaSeriesStack)
+};
+
+QT_END_NAMESPACE
+
+#endif // QAREASERIESSTACK_P_H
@@ -186,6 +186,27 @@ QT_BEGIN_NAMESPACE
         Ticks are placed evenly across the axis range. The tickCount value specifies the number of ticks.
 */
 
+/*!
+  \property QValueAxis::fitToVisiblePoints
+  \since 6.2
+  \brief Whether a vertical axis follows the points visible in the horizontal range.
+
+  When this property is \c true, the range of a vertical axis is set to the range of y values
+  of the points that are visible whenever the chart is zoomed or scrolled horizontally.
+  Only the series attached to both this axis and the changed horizontal axis are taken into
+  account. The range is found in logarithmic time for series that have their points in
+  ascending order of x values. Fitting is only done in cartesian charts with linear axes.
+
+  The default value is \c false.
+*/
+/*!
+  \qmlproperty bool ValueAxis::fitToVisiblePoints
+  \since 6.2
+
+  Whether a vertical axis follows the y range of the points that are visible when the
+  chart is zoomed or scrolled horizontally. The default value is \c false.
+*/
+
 /*!
   \property QValueAxis::labelFormat
   \brief The label format of the axis.
@@ -247,6 +268,13 @@ QT_BEGIN_NAMESPACE
     The corresponding signal handler is \c onRangeChanged.
 */
 
+/*!
+  \fn void QValueAxis::fitToVisiblePointsChanged(bool fit)
+  \since 6.2
+  This signal is emitted when fitting the axis to the visible points, specified by \a fit,
+  is enabled or disabled.
+*/
+
 /*!
   \fn void QValueAxis::labelFormatChanged(const QString &format)
   This signal is emitted when the \a format of axis labels changes.
@@ -403,6 +431,21 @@ QString QValueAxis::labelFormat() const
     return d->m_format;
 }
 
+void QValueAxis::setFitToVisiblePoints(bool fit)
+{
+    Q_D(QValueAxis);
+    if (d->m_fitToVisiblePoints != fit) {
+        d->m_fitToVisiblePoints = fit;
+        emit fitToVisiblePointsChanged(fit);
+    }
+}
+
+bool QValueAxis::fitToVisiblePoints() const
+{
+    Q_D(const QValueAxis);
+    return d->m_fitToVisiblePoints;
+}
+
 /*!
   Returns the type of the axis.
 */
@@ -452,7 +495,8 @@ QValueAxisPrivate::QValueAxisPrivate(QValueAxis *q)
       m_applying(false),
       m_tickInterval(0.0),
       m_tickAnchor(0.0),
-      m_tickType(QValueAxis::TicksFixed)
+      m_tickType(QValueAxis::TicksFixed),
+      m_fitToVisiblePoints(false)
 {
 
 }
@@ -47,6 +47,7 @@ class Q_CHARTS_EXPORT QValueAxis : public QAbstractAxis
     Q_PROPERTY(qreal tickAnchor READ tickAnchor WRITE setTickAnchor NOTIFY tickAnchorChanged REVISION 1)
     Q_PROPERTY(qreal tickInterval READ tickInterval WRITE setTickInterval NOTIFY tickIntervalChanged REVISION 1)
     Q_PROPERTY(TickType tickType READ tickType WRITE setTickType NOTIFY tickTypeChanged REVISION 1)
+    Q_PROPERTY(bool fitToVisiblePoints READ fitToVisiblePoints WRITE setFitToVisiblePoints NOTIFY fitToVisiblePointsChanged REVISION(6, 2))
     Q_ENUMS(TickType)
 
 public:
@@ -87,6 +88,9 @@ public:
     void setLabelFormat(const QString &format);
     QString labelFormat() const;
 
+    void setFitToVisiblePoints(bool fit);
+    bool fitToVisiblePoints() const;
+
 public Q_SLOTS:
     void applyNiceNumbers();
 
@@ -100,6 +104,7 @@ Q_SIGNALS:
     Q_REVISION(1) void tickIntervalChanged(qreal interval);
     Q_REVISION(1) void tickAnchorChanged(qreal anchor);
     Q_REVISION(1) void tickTypeChanged(QValueAxis::TickType type);
+    Q_REVISION(6, 2) void fitToVisiblePointsChanged(bool fit);
 
 private:
     Q_DECLARE_PRIVATE(QValueAxis)
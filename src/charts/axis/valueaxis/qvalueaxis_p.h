@@ -78,6 +78,7 @@ private:
     qreal m_tickInterval;
     qreal m_tickAnchor;
     QValueAxis::TickType m_tickType;
+    bool m_fitToVisiblePoints;
     Q_DECLARE_PUBLIC(QValueAxis)
 };
 
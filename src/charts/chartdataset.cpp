@@ -50,6 +50,8 @@
 #include <private/logxypolardomain_p.h>
 #include <private/logxlogypolardomain_p.h>
 #include <private/glxyseriesdata_p.h>
+#include <private/xygeometrybatch_p.h>
+#include <private/qxyseries_p.h>
 
 #if QT_CONFIG(charts_datetime_axis)
 #include <QtCharts/QDateTimeAxis>
@@ -60,7 +62,8 @@ QT_BEGIN_NAMESPACE
 ChartDataSet::ChartDataSet(QChart *chart)
     : QObject(chart),
       m_chart(chart),
-      m_glXYSeriesDataManager(new GLXYSeriesDataManager(this))
+      m_glXYSeriesDataManager(new GLXYSeriesDataManager(this)),
+      m_geometryBatch(new XYGeometryBatch(this))
 {
 
 }
@@ -285,9 +288,14 @@ bool ChartDataSet::attachAxis(QAbstractSeries *series,QAbstractAxis *axis)
     series->d_ptr->initializeAxes();
     axis->d_ptr->initializeDomain(domain);
     connect(axis, &QAbstractAxis::reverseChanged, this, &ChartDataSet::reverseChanged);
+    if (QValueAxis *valueAxis = qobject_cast<QValueAxis *>(axis)) {
+        connect(valueAxis, &QValueAxis::fitToVisiblePointsChanged,
+                this, &ChartDataSet::updateFitToVisiblePoints, Qt::UniqueConnection);
+    }
     foreach (AbstractDomain *blockedDomain, blockedDomains)
         blockedDomain->blockRangeSignals(false);
 
+    updateFitToVisiblePoints();
     return true;
 }
 
@@ -324,6 +332,13 @@ bool ChartDataSet::detachAxis(QAbstractSeries* series,QAbstractAxis *axis)
     series->d_ptr->m_axes.removeAll(axis);
     axis->d_ptr->m_series.removeAll(series);
     disconnect(axis, &QAbstractAxis::reverseChanged, this, &ChartDataSet::reverseChanged);
+    QValueAxis *valueAxis = qobject_cast<QValueAxis *>(axis);
+    if (valueAxis && axis->d_ptr->m_series.isEmpty()) {
+        disconnect(valueAxis, &QValueAxis::fitToVisiblePointsChanged,
+                   this, &ChartDataSet::updateFitToVisiblePoints);
+    }
+
+    updateFitToVisiblePoints();
     return true;
 }
 
@@ -438,6 +453,8 @@ void ChartDataSet::deleteAllAxes()
 
 void ChartDataSet::zoomInDomain(const QRectF &rect)
 {
+    m_geometryBatch->begin();
+
     QList<AbstractDomain*> domains;
     foreach(QAbstractSeries *s, m_seriesList) {
         AbstractDomain* domain = s->d_ptr->domain();
@@ -445,15 +462,21 @@ void ChartDataSet::zoomInDomain(const QRectF &rect)
         domains<<domain;
     }
 
+    const QList<QPair<qreal, qreal>> rangesX = horizontalRanges(domains);
     foreach(AbstractDomain *domain, domains)
         domain->zoomIn(rect);
+    fitAxesToVisiblePoints(domains, rangesX);
 
     foreach(AbstractDomain *domain, domains)
         domain->blockRangeSignals(false);
+
+    m_geometryBatch->end();
 }
 
 void ChartDataSet::zoomOutDomain(const QRectF &rect)
 {
+    m_geometryBatch->begin();
+
     QList<AbstractDomain*> domains;
     foreach(QAbstractSeries *s, m_seriesList) {
         AbstractDomain* domain = s->d_ptr->domain();
@@ -461,15 +484,21 @@ void ChartDataSet::zoomOutDomain(const QRectF &rect)
         domains<<domain;
     }
 
+    const QList<QPair<qreal, qreal>> rangesX = horizontalRanges(domains);
     foreach(AbstractDomain *domain, domains)
         domain->zoomOut(rect);
+    fitAxesToVisiblePoints(domains, rangesX);
 
     foreach(AbstractDomain *domain, domains)
         domain->blockRangeSignals(false);
+
+    m_geometryBatch->end();
 }
 
 void ChartDataSet::zoomResetDomain()
 {
+    m_geometryBatch->begin();
+
     QList<AbstractDomain*> domains;
     foreach (QAbstractSeries *s, m_seriesList) {
         AbstractDomain *domain = s->d_ptr->domain();
@@ -482,6 +511,8 @@ void ChartDataSet::zoomResetDomain()
 
     foreach (AbstractDomain *domain, domains)
         domain->blockRangeSignals(false);
+
+    m_geometryBatch->end();
 }
 
 bool ChartDataSet::isZoomedDomain()
@@ -495,6 +526,8 @@ bool ChartDataSet::isZoomedDomain()
 
 void ChartDataSet::scrollDomain(qreal dx, qreal dy)
 {
+    m_geometryBatch->begin();
+
     QList<AbstractDomain*> domains;
     foreach(QAbstractSeries *s, m_seriesList) {
         AbstractDomain* domain = s->d_ptr->domain();
@@ -502,11 +535,15 @@ void ChartDataSet::scrollDomain(qreal dx, qreal dy)
         domains<<domain;
     }
 
+    const QList<QPair<qreal, qreal>> rangesX = horizontalRanges(domains);
     foreach(AbstractDomain *domain, domains)
         domain->move(dx, dy);
+    fitAxesToVisiblePoints(domains, rangesX);
 
     foreach(AbstractDomain *domain, domains)
         domain->blockRangeSignals(false);
+
+    m_geometryBatch->end();
 }
 
 QPointF ChartDataSet::mapToValue(const QPointF &position, QAbstractSeries *series)
@@ -654,6 +691,93 @@ AbstractDomain *ChartDataSet::domainForSeries(QAbstractSeries *series) const
     return series->d_ptr->domain();
 }
 
+// Returns a copy of the domain of the series that isn't connected to the axes, so it can be
+// used by another thread while the original domain changes.
+AbstractDomain *ChartDataSet::copyDomain(QAbstractSeries *series)
+{
+    AbstractDomain *domain = series->d_ptr->domain();
+    AbstractDomain *copy = createDomain(domain->type());
+    if (!copy)
+        return nullptr;
+
+    // Attaching the axes picks up settings such as the base of log axes
+    for (QAbstractAxis *axis : qAsConst(series->d_ptr->m_axes)) {
+        copy->attachAxis(axis);
+        copy->detachAxis(axis);
+    }
+    copy->setSize(domain->size());
+    copy->setRange(domain->minX(), domain->maxX(), domain->minY(), domain->maxY());
+    copy->setReverseX(domain->isReverseX());
+    copy->setReverseY(domain->isReverseY());
+    return copy;
+}
+
+// Collects the vertical value axes that fit the visible points, so that zooming and
+// scrolling don't need to look them up.
+void ChartDataSet::updateFitToVisiblePoints()
+{
+    m_fitAxes.clear();
+    foreach (QAbstractAxis *axis, m_axisList) {
+        QValueAxis *valueAxis = qobject_cast<QValueAxis *>(axis);
+        if (valueAxis && valueAxis->orientation() == Qt::Vertical
+                && valueAxis->fitToVisiblePoints() && !axis->d_ptr->m_series.isEmpty()) {
+            m_fitAxes << valueAxis;
+        }
+    }
+}
+
+QList<QPair<qreal, qreal>> ChartDataSet::horizontalRanges(const QList<AbstractDomain *> &domains)
+{
+    QList<QPair<qreal, qreal>> ranges;
+    ranges.reserve(domains.size());
+    foreach (AbstractDomain *domain, domains)
+        ranges << qMakePair(domain->minX(), domain->maxX());
+    return ranges;
+}
+
+// Sets each fitted axis to the union of the visible y ranges of all the series attached to
+// it. This is done once per axis after all the domains have been zoomed or scrolled, and
+// while their range signals are still blocked, so that every domain of the axis reports the
+// same range when the signals are unblocked. Axes are only fitted when the horizontal range
+// of one of their series changed, and log and polar domains are not fitted.
+void ChartDataSet::fitAxesToVisiblePoints(const QList<AbstractDomain *> &domains,
+                                          const QList<QPair<qreal, qreal>> &rangesX)
+{
+    foreach (QValueAxis *axis, m_fitAxes) {
+        bool changed = false;
+        bool found = false;
+        qreal minY = 0;
+        qreal maxY = 0;
+        foreach (QAbstractSeries *series, axis->d_ptr->m_series) {
+            AbstractDomain *domain = series->d_ptr->domain();
+            if (!qobject_cast<QXYSeries *>(series) || domain->type() != AbstractDomain::XYDomain)
+                continue;
+            const int index = domains.indexOf(domain);
+            if (index >= 0 && rangesX.at(index) != qMakePair(domain->minX(), domain->maxX()))
+                changed = true;
+
+            qreal seriesMinY;
+            qreal seriesMaxY;
+            QXYSeriesPrivate *xySeries = static_cast<QXYSeriesPrivate *>(series->d_ptr.data());
+            if (!xySeries->visibleRangeY(domain->minX(), domain->maxX(), seriesMinY, seriesMaxY))
+                continue;
+            minY = found ? qMin(minY, seriesMinY) : seriesMinY;
+            maxY = found ? qMax(maxY, seriesMaxY) : seriesMaxY;
+            found = true;
+        }
+
+        // Keep the current range if there is nothing to fit to
+        if (!changed || !found)
+            continue;
+
+        if (minY == maxY) {
+            minY -= 0.5;
+            maxY += 0.5;
+        }
+        axis->setRange(minY, maxY);
+    }
+}
+
 void ChartDataSet::reverseChanged()
 {
     QAbstractAxis *axis = qobject_cast<QAbstractAxis *>(sender());
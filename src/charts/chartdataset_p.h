@@ -48,8 +48,10 @@
 QT_BEGIN_NAMESPACE
 
 class QAbstractAxis;
+class QValueAxis;
 class ChartPresenter;
 class GLXYSeriesDataManager;
+class XYGeometryBatch;
 
 class Q_CHARTS_PRIVATE_EXPORT ChartDataSet : public QObject
 {
@@ -81,9 +83,11 @@ public:
     QPointF mapToPosition(const QPointF &value, QAbstractSeries *series = 0);
 
     GLXYSeriesDataManager *glXYSeriesDataManager() { return m_glXYSeriesDataManager; }
+    XYGeometryBatch *geometryBatch() { return m_geometryBatch; }
 
     AbstractDomain* createDomain(AbstractDomain::DomainType type);
     AbstractDomain* domainForSeries(QAbstractSeries *series) const;
+    AbstractDomain *copyDomain(QAbstractSeries *series);
 
 Q_SIGNALS:
     void axisAdded(QAbstractAxis* axis);
@@ -92,6 +96,7 @@ Q_SIGNALS:
     void seriesRemoved(QAbstractSeries* series);
 public Q_SLOTS:
     void reverseChanged();
+    void updateFitToVisiblePoints();
 private:
     void createAxes(QAbstractAxis::AxisTypes type, Qt::Orientation orientation);
     QAbstractAxis *createAxis(QAbstractAxis::AxisType type, Qt::Orientation orientation);
@@ -100,12 +105,17 @@ private:
     void deleteAllSeries();
     void findMinMaxForSeries(const QList<QAbstractSeries *> &series, Qt::Orientations orientation,
                              qreal &min, qreal &max);
+    static QList<QPair<qreal, qreal>> horizontalRanges(const QList<AbstractDomain *> &domains);
+    void fitAxesToVisiblePoints(const QList<AbstractDomain *> &domains,
+                                const QList<QPair<qreal, qreal>> &rangesX);
 
 private:
     QList<QAbstractSeries *> m_seriesList;
     QList<QAbstractAxis *> m_axisList;
     QChart* m_chart;
     GLXYSeriesDataManager *m_glXYSeriesDataManager;
+    XYGeometryBatch *m_geometryBatch;
+    QList<QValueAxis *> m_fitAxes;
 };
 
 QT_END_NAMESPACE
@@ -41,6 +41,7 @@
 #include <private/cartesianchartlayout_p.h>
 #include <private/polarchartlayout_p.h>
 #include <private/charttitle_p.h>
+#include <private/xychart_p.h>
 #include <QtCore/QRegularExpression>
 #include <QtCore/QTimer>
 #include <QtGui/QTextDocument>
@@ -64,6 +65,8 @@ ChartPresenter::ChartPresenter(QChart *chart, QChart::ChartType type)
       , m_glWidget(0)
       , m_glUseWidget(true)
 #endif
+      , m_coalesceSeriesUpdates(false)
+      , m_coalescedUpdateTimer(nullptr)
 {
     if (type == QChart::ChartTypeCartesian)
         m_layout = new CartesianChartLayout(this);
@@ -438,6 +441,43 @@ void ChartPresenter::setLocale(const QLocale &locale)
     m_layout->invalidate();
 }
 
+void ChartPresenter::setCoalesceSeriesUpdates(bool coalesce)
+{
+    if (m_coalesceSeriesUpdates == coalesce)
+        return;
+    m_coalesceSeriesUpdates = coalesce;
+    if (!coalesce)
+        processCoalescedUpdates();
+}
+
+// The changes to the series are collected by the items, and all the items are updated
+// together once per frame.
+void ChartPresenter::scheduleCoalescedUpdate(XYChart *item)
+{
+    if (!m_coalescedUpdateTimer) {
+        m_coalescedUpdateTimer = new QTimer(this);
+        m_coalescedUpdateTimer->setSingleShot(true);
+        m_coalescedUpdateTimer->setInterval(16);
+        connect(m_coalescedUpdateTimer, &QTimer::timeout,
+                this, &ChartPresenter::processCoalescedUpdates);
+    }
+    m_coalescedItems.append(item);
+    if (!m_coalescedUpdateTimer->isActive())
+        m_coalescedUpdateTimer->start();
+}
+
+void ChartPresenter::processCoalescedUpdates()
+{
+    if (m_coalescedUpdateTimer)
+        m_coalescedUpdateTimer->stop();
+    const QList<QPointer<XYChart>> items = m_coalescedItems;
+    m_coalescedItems.clear();
+    for (const QPointer<XYChart> &item : items) {
+        if (!item.isNull())
+            item->handleCoalescedUpdate();
+    }
+}
+
 AbstractChartLayout *ChartPresenter::layout()
 {
     return m_layout;
@@ -62,6 +62,8 @@ class ChartBackground;
 class ChartTitle;
 class ChartAnimation;
 class AbstractChartLayout;
+class XYChart;
+class QTimer;
 
 class Q_CHARTS_PRIVATE_EXPORT ChartPresenter: public QObject
 {
@@ -151,6 +153,10 @@ public:
     void setLocale(const QLocale &locale);
     inline const QLocale &locale() const { return m_locale; }
 
+    void setCoalesceSeriesUpdates(bool coalesce);
+    bool coalesceSeriesUpdates() const { return m_coalesceSeriesUpdates; }
+    void scheduleCoalescedUpdate(XYChart *item);
+
     void setVisible(bool visible);
 
     void setAnimationOptions(QChart::AnimationOptions options);
@@ -195,6 +201,9 @@ public Q_SLOTS:
 Q_SIGNALS:
     void plotAreaChanged(const QRectF &plotArea);
 
+private Q_SLOTS:
+    void processCoalescedUpdates();
+
 private:
     QChart *m_chart;
     QList<ChartItem *> m_chartItems;
@@ -218,6 +227,9 @@ private:
 #endif
     bool m_glUseWidget;
     QRectF m_fixedRect;
+    bool m_coalesceSeriesUpdates;
+    QTimer *m_coalescedUpdateTimer;
+    QList<QPointer<XYChart>> m_coalescedItems;
 };
 
 QT_END_NAMESPACE
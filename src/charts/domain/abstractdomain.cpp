@@ -29,8 +29,10 @@
 
 #include <private/abstractdomain_p.h>
 #include <private/qabstractaxis_p.h>
+#include <private/domaintransforms_p.h>
 #include <QtCore/QtMath>
 #include <cmath>
+#include <algorithm>
 
 QT_BEGIN_NAMESPACE
 
@@ -173,6 +175,90 @@ void AbstractDomain::storeZoomReset()
     }
 }
 
+// Finds the part of the list, sorted by ascending x, that is needed to draw the visible
+// x range. The closest point outside the range on each side is included as well, so that
+// lines leaving the plot area are still drawn up to its edge.
+void AbstractDomain::visibleIndexRange(const QList<QPointF> &list, int &first, int &last) const
+{
+    const auto begin = list.cbegin();
+    const auto end = list.cend();
+    const auto lower = std::lower_bound(begin, end, m_minX, [](const QPointF &point, qreal x) {
+        return point.x() < x;
+    });
+    const auto upper = std::upper_bound(lower, end, m_maxX, [](qreal x, const QPointF &point) {
+        return x < point.x();
+    });
+    first = qMax(0, int(lower - begin) - 1);
+    last = qMin(int(list.count()) - 1, int(upper - begin));
+}
+
+QList<QPointF> AbstractDomain::calculateGeometryPoints(const QList<QPointF> &list) const
+{
+    QList<QPointF> result = list;
+    if (!transformGeometryPoints(result.data(), result.count()))
+        return QList<QPointF>();
+    return result;
+}
+
+// Same as above, for points stored as separate x and y columns. The columns are gathered
+// straight into the result, which is then transformed in place.
+QList<QPointF> AbstractDomain::calculateGeometryPoints(const qreal *x, const qreal *y,
+                                                       qsizetype count) const
+{
+    QList<QPointF> result(count);
+    DomainTransforms::interleave(result.data(), x, y, count);
+    if (!transformGeometryPoints(result.data(), count))
+        return QList<QPointF>();
+    return result;
+}
+
+void AbstractDomain::visibleIndexRange(const qreal *x, qsizetype count, int &first,
+                                       int &last) const
+{
+    const qreal *lower = std::lower_bound(x, x + count, m_minX);
+    const qreal *upper = std::upper_bound(lower, x + count, m_maxX);
+    first = qMax(0, int(lower - x) - 1);
+    last = qMin(int(count) - 1, int(upper - x));
+}
+
+// Same as calculateGeometryPoints(), but for a list sorted by ascending x only the visible
+// part of the list is transformed, together with the closest point on both sides of it.
+// The result only covers that part, and first is set to the index of the list that its
+// first point belongs to. Points outside the visible part are not validated.
+QList<QPointF> AbstractDomain::calculateVisibleGeometryPoints(const QList<QPointF> &list,
+                                                              int &first) const
+{
+    first = 0;
+    if (list.isEmpty())
+        return QList<QPointF>();
+
+    int last = 0;
+    visibleIndexRange(list, first, last);
+    if (first == 0 && last == list.count() - 1)
+        return calculateGeometryPoints(list);
+
+    const QList<QPointF> visible = calculateGeometryPoints(list.mid(first, last - first + 1));
+    if (visible.isEmpty())
+        first = 0;
+    return visible;
+}
+
+QList<QPointF> AbstractDomain::calculateVisibleGeometryPoints(const qreal *x, const qreal *y,
+                                                              qsizetype count, int &first) const
+{
+    first = 0;
+    if (count == 0)
+        return QList<QPointF>();
+
+    int last = 0;
+    visibleIndexRange(x, count, first, last);
+    const QList<QPointF> visible =
+            calculateGeometryPoints(x + first, y + first, last - first + 1);
+    if (visible.isEmpty())
+        first = 0;
+    return visible;
+}
+
 //algorithm defined by Paul S.Heckbert GraphicalGems I
 
 void AbstractDomain::looseNiceNumbers(qreal &min, qreal &max, int &ticksCount)
@@ -104,7 +104,13 @@ public:
 
     virtual QPointF calculateGeometryPoint(const QPointF &point, bool &ok) const = 0;
     virtual QPointF calculateDomainPoint(const QPointF &point) const = 0;
-    virtual QList<QPointF> calculateGeometryPoints(const QList<QPointF> &list) const = 0;
+    QList<QPointF> calculateGeometryPoints(const QList<QPointF> &list) const;
+    QList<QPointF> calculateGeometryPoints(const qreal *x, const qreal *y, qsizetype count) const;
+    QList<QPointF> calculateVisibleGeometryPoints(const QList<QPointF> &list, int &first) const;
+    QList<QPointF> calculateVisibleGeometryPoints(const qreal *x, const qreal *y,
+                                                  qsizetype count, int &first) const;
+    void visibleIndexRange(const QList<QPointF> &list, int &first, int &last) const;
+    void visibleIndexRange(const qreal *x, qsizetype count, int &first, int &last) const;
 
     virtual bool attachAxis(QAbstractAxis *axis);
     virtual bool detachAxis(QAbstractAxis *axis);
@@ -130,6 +136,10 @@ public Q_SLOTS:
     void handleReverseYChanged(bool reverse);
 
 protected:
+    // Transforms the points to geometry in place. Returns false if the points can't be
+    // shown in the domain, for example because of negative values on a log axis.
+    virtual bool transformGeometryPoints(QPointF *points, qsizetype count) const = 0;
+
     void adjustLogDomainRanges(qreal &min, qreal &max);
     QRectF fixZoomRect(const QRectF &rect);
 
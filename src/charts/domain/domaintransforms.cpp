@@ -0,0 +1,320 @@
+/****************************************************************************
+**
+** Copyright (C) 2021 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <private/domaintransforms_p.h>
+#include <QtCore/QtMath>
+#include <QtCore/private/qsimd_p.h>
+#include <cmath>
+
+// The vector paths treat the points as a flat array of doubles
+#if defined(__SSE2__) && !defined(QT_COORD_TYPE)
+#  define DOMAINTRANSFORMS_SSE2
+#  include <immintrin.h>
+#  if QT_COMPILER_SUPPORTS_HERE(AVX2)
+#    define DOMAINTRANSFORMS_AVX2
+#  endif
+#endif
+
+QT_BEGIN_NAMESPACE
+
+static inline void scaleScalar(QPointF *points, qsizetype from, qsizetype count,
+                               const QPointF &origin, qreal scaleX, qreal scaleY,
+                               const QPointF &offset)
+{
+    for (qsizetype i = from; i < count; ++i) {
+        points[i].setX((points[i].x() - origin.x()) * scaleX + offset.x());
+        points[i].setY((points[i].y() - origin.y()) * scaleY + offset.y());
+    }
+}
+
+static inline void clampScalar(QPointF *points, qsizetype from, qsizetype count,
+                               const QPointF &minimum)
+{
+    for (qsizetype i = from; i < count; ++i) {
+        if (points[i].x() < minimum.x())
+            points[i].setX(minimum.x());
+        if (points[i].y() < minimum.y())
+            points[i].setY(minimum.y());
+    }
+}
+
+static inline bool isPositiveScalar(const QPointF *points, qsizetype from, qsizetype count,
+                                    bool x, bool y)
+{
+    for (qsizetype i = from; i < count; ++i) {
+        if ((x && !(points[i].x() > 0)) || (y && !(points[i].y() > 0)))
+            return false;
+    }
+    return true;
+}
+
+static inline void interleaveScalar(QPointF *points, const qreal *x, const qreal *y,
+                                    qsizetype from, qsizetype count)
+{
+    for (qsizetype i = from; i < count; ++i)
+        points[i] = QPointF(x[i], y[i]);
+}
+
+#ifdef DOMAINTRANSFORMS_SSE2
+static void scaleSse2(QPointF *points, qsizetype count, const QPointF &origin,
+                      qreal scaleX, qreal scaleY, const QPointF &offset)
+{
+    double *data = reinterpret_cast<double *>(points);
+    const __m128d o = _mm_set_pd(origin.y(), origin.x());
+    const __m128d s = _mm_set_pd(scaleY, scaleX);
+    const __m128d t = _mm_set_pd(offset.y(), offset.x());
+    for (qsizetype i = 0; i < count; ++i) {
+        const __m128d p = _mm_loadu_pd(data + 2 * i);
+        _mm_storeu_pd(data + 2 * i, _mm_add_pd(_mm_mul_pd(_mm_sub_pd(p, o), s), t));
+    }
+}
+
+static void clampSse2(QPointF *points, qsizetype count, const QPointF &minimum)
+{
+    double *data = reinterpret_cast<double *>(points);
+    const __m128d m = _mm_set_pd(minimum.y(), minimum.x());
+    for (qsizetype i = 0; i < count; ++i) {
+        // Operand order keeps NaN coordinates as they are, like the scalar version
+        _mm_storeu_pd(data + 2 * i, _mm_max_pd(m, _mm_loadu_pd(data + 2 * i)));
+    }
+}
+
+static bool isPositiveSse2(const QPointF *points, qsizetype count, bool x, bool y)
+{
+    const double *data = reinterpret_cast<const double *>(points);
+    const __m128d zero = _mm_setzero_pd();
+    // Coordinates that are not checked always pass
+    const __m128d ignored = _mm_castsi128_pd(_mm_set_epi64x(y ? 0 : -1, x ? 0 : -1));
+    __m128d result = _mm_castsi128_pd(_mm_set1_epi64x(-1));
+    for (qsizetype i = 0; i < count; ++i) {
+        const __m128d positive = _mm_cmpgt_pd(_mm_loadu_pd(data + 2 * i), zero);
+        result = _mm_and_pd(result, _mm_or_pd(positive, ignored));
+    }
+    return _mm_movemask_pd(result) == 3;
+}
+
+static void interleaveSse2(QPointF *points, const qreal *x, const qreal *y, qsizetype count)
+{
+    double *data = reinterpret_cast<double *>(points);
+    qsizetype i = 0;
+    for (; i + 2 <= count; i += 2) {
+        const __m128d px = _mm_loadu_pd(x + i);
+        const __m128d py = _mm_loadu_pd(y + i);
+        _mm_storeu_pd(data + 2 * i, _mm_unpacklo_pd(px, py));
+        _mm_storeu_pd(data + 2 * i + 2, _mm_unpackhi_pd(px, py));
+    }
+    interleaveScalar(points, x, y, i, count);
+}
+#endif
+
+#ifdef DOMAINTRANSFORMS_AVX2
+QT_FUNCTION_TARGET(AVX2)
+static void scaleAvx2(QPointF *points, qsizetype count, const QPointF &origin,
+                      qreal scaleX, qreal scaleY, const QPointF &offset)
+{
+    double *data = reinterpret_cast<double *>(points);
+    const __m256d o = _mm256_set_pd(origin.y(), origin.x(), origin.y(), origin.x());
+    const __m256d s = _mm256_set_pd(scaleY, scaleX, scaleY, scaleX);
+    const __m256d t = _mm256_set_pd(offset.y(), offset.x(), offset.y(), offset.x());
+    qsizetype i = 0;
+    for (; i + 2 <= count; i += 2) {
+        const __m256d p = _mm256_loadu_pd(data + 2 * i);
+        // No FMA, so that the results are identical to the other paths
+        _mm256_storeu_pd(data + 2 * i,
+                         _mm256_add_pd(_mm256_mul_pd(_mm256_sub_pd(p, o), s), t));
+    }
+    scaleScalar(points, i, count, origin, scaleX, scaleY, offset);
+}
+
+QT_FUNCTION_TARGET(AVX2)
+static void clampAvx2(QPointF *points, qsizetype count, const QPointF &minimum)
+{
+    double *data = reinterpret_cast<double *>(points);
+    const __m256d m = _mm256_set_pd(minimum.y(), minimum.x(), minimum.y(), minimum.x());
+    qsizetype i = 0;
+    for (; i + 2 <= count; i += 2)
+        _mm256_storeu_pd(data + 2 * i, _mm256_max_pd(m, _mm256_loadu_pd(data + 2 * i)));
+    clampScalar(points, i, count, minimum);
+}
+
+QT_FUNCTION_TARGET(AVX2)
+static bool isPositiveAvx2(const QPointF *points, qsizetype count, bool x, bool y)
+{
+    const double *data = reinterpret_cast<const double *>(points);
+    const __m256d zero = _mm256_setzero_pd();
+    const __m256d ignored = _mm256_castsi256_pd(_mm256_set_epi64x(y ? 0 : -1, x ? 0 : -1,
+                                                                  y ? 0 : -1, x ? 0 : -1));
+    __m256d result = _mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+    qsizetype i = 0;
+    for (; i + 2 <= count; i += 2) {
+        const __m256d positive = _mm256_cmp_pd(_mm256_loadu_pd(data + 2 * i), zero, _CMP_GT_OQ);
+        result = _mm256_and_pd(result, _mm256_or_pd(positive, ignored));
+    }
+    return _mm256_movemask_pd(result) == 0xf && isPositiveScalar(points, i, count, x, y);
+}
+#endif
+
+static DomainTransforms::Kernel forcedKernel = DomainTransforms::AutomaticKernel;
+
+// The widest kernel the CPU supports, unless one has been forced
+static DomainTransforms::Kernel activeKernel()
+{
+    if (forcedKernel != DomainTransforms::AutomaticKernel)
+        return forcedKernel;
+#ifdef DOMAINTRANSFORMS_AVX2
+    if (qCpuHasFeature(AVX2))
+        return DomainTransforms::Avx2Kernel;
+#endif
+#ifdef DOMAINTRANSFORMS_SSE2
+    return DomainTransforms::Sse2Kernel;
+#else
+    return DomainTransforms::ScalarKernel;
+#endif
+}
+
+bool DomainTransforms::setKernel(Kernel kernel)
+{
+    if (!isKernelSupported(kernel))
+        return false;
+    forcedKernel = kernel;
+    return true;
+}
+
+DomainTransforms::Kernel DomainTransforms::kernel()
+{
+    return activeKernel();
+}
+
+bool DomainTransforms::isKernelSupported(Kernel kernel)
+{
+    switch (kernel) {
+    case AutomaticKernel:
+    case ScalarKernel:
+        return true;
+#ifdef DOMAINTRANSFORMS_SSE2
+    case Sse2Kernel:
+        return true;
+#endif
+#ifdef DOMAINTRANSFORMS_AVX2
+    case Avx2Kernel:
+        return qCpuHasFeature(AVX2);
+#endif
+    default:
+        return false;
+    }
+}
+
+void DomainTransforms::scale(QPointF *points, qsizetype count, const QPointF &origin,
+                             qreal scaleX, qreal scaleY, const QPointF &offset)
+{
+    switch (activeKernel()) {
+#ifdef DOMAINTRANSFORMS_AVX2
+    case Avx2Kernel:
+        return scaleAvx2(points, count, origin, scaleX, scaleY, offset);
+#endif
+#ifdef DOMAINTRANSFORMS_SSE2
+    case Sse2Kernel:
+        return scaleSse2(points, count, origin, scaleX, scaleY, offset);
+#endif
+    default:
+        return scaleScalar(points, 0, count, origin, scaleX, scaleY, offset);
+    }
+}
+
+void DomainTransforms::clamp(QPointF *points, qsizetype count, const QPointF &minimum)
+{
+    switch (activeKernel()) {
+#ifdef DOMAINTRANSFORMS_AVX2
+    case Avx2Kernel:
+        return clampAvx2(points, count, minimum);
+#endif
+#ifdef DOMAINTRANSFORMS_SSE2
+    case Sse2Kernel:
+        return clampSse2(points, count, minimum);
+#endif
+    default:
+        return clampScalar(points, 0, count, minimum);
+    }
+}
+
+bool DomainTransforms::isPositive(const QPointF *points, qsizetype count, bool x, bool y)
+{
+    if (!x && !y)
+        return true;
+    switch (activeKernel()) {
+#ifdef DOMAINTRANSFORMS_AVX2
+    case Avx2Kernel:
+        return isPositiveAvx2(points, count, x, y);
+#endif
+#ifdef DOMAINTRANSFORMS_SSE2
+    case Sse2Kernel:
+        return isPositiveSse2(points, count, x, y);
+#endif
+    default:
+        return isPositiveScalar(points, 0, count, x, y);
+    }
+}
+
+// There is no AVX2 version, the shuffles don't cross the lanes of the wider registers well
+void DomainTransforms::interleave(QPointF *points, const qreal *x, const qreal *y,
+                                  qsizetype count)
+{
+#ifdef DOMAINTRANSFORMS_SSE2
+    if (activeKernel() != ScalarKernel)
+        return interleaveSse2(points, x, y, count);
+#endif
+    interleaveScalar(points, x, y, 0, count);
+}
+
+// There is no vector instruction for logarithms, so this stays scalar. Keeping it in a
+// separate pass still lets the affine part of the log domains be vectorized.
+void DomainTransforms::log10(QPointF *points, qsizetype count, bool x, bool y)
+{
+    if (x && y) {
+        for (qsizetype i = 0; i < count; ++i)
+            points[i] = QPointF(std::log10(points[i].x()), std::log10(points[i].y()));
+    } else if (x) {
+        for (qsizetype i = 0; i < count; ++i)
+            points[i].setX(std::log10(points[i].x()));
+    } else if (y) {
+        for (qsizetype i = 0; i < count; ++i)
+            points[i].setY(std::log10(points[i].y()));
+    }
+}
+
+void DomainTransforms::polarToCartesian(QPointF *points, qsizetype count, const QPointF &center)
+{
+    for (qsizetype i = 0; i < count; ++i) {
+        const qreal angle = qDegreesToRadians(points[i].x());
+        const qreal radius = points[i].y();
+        points[i] = QPointF(center.x() + qSin(angle) * radius, center.y() - qCos(angle) * radius);
+    }
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,83 @@
+/****************************************************************************
+**
+** Copyright (C) 2021 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt Chart API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+
+#ifndef DOMAINTRANSFORMS_P_H
+#define DOMAINTRANSFORMS_P_H
+
+#include <QtCharts/private/qchartglobal_p.h>
+#include <QtCore/QPointF>
+
+QT_BEGIN_NAMESPACE
+
+// Building blocks of the domain transforms. They work in place on arrays of points and
+// use the widest vector instructions the CPU supports at runtime.
+class Q_CHARTS_PRIVATE_EXPORT DomainTransforms
+{
+public:
+    enum Kernel {
+        AutomaticKernel,
+        ScalarKernel,
+        Sse2Kernel,
+        Avx2Kernel
+    };
+
+    // Forces the kernels to one instruction set, for tests and benchmarks. Returns false,
+    // and keeps the current selection, if the kernel is not available on this CPU or build.
+    static bool setKernel(Kernel kernel);
+    static Kernel kernel();
+    static bool isKernelSupported(Kernel kernel);
+
+    // point = (point - origin) * scale + offset, per coordinate
+    static void scale(QPointF *points, qsizetype count, const QPointF &origin,
+                      qreal scaleX, qreal scaleY, const QPointF &offset);
+    // point = max(point, minimum), per coordinate
+    static void clamp(QPointF *points, qsizetype count, const QPointF &minimum);
+    // Returns true if the selected coordinates of all the points are greater than zero
+    static bool isPositive(const QPointF *points, qsizetype count, bool x, bool y);
+    // Replaces the selected coordinates with their base 10 logarithm
+    static void log10(QPointF *points, qsizetype count, bool x, bool y);
+    // points[i] = (x[i], y[i]), for series stored as separate columns
+    static void interleave(QPointF *points, const qreal *x, const qreal *y, qsizetype count);
+    // Maps (angle in degrees, radius) pairs to points around the center
+    static void polarToCartesian(QPointF *points, qsizetype count, const QPointF &center);
+};
+
+QT_END_NAMESPACE
+
+#endif // DOMAINTRANSFORMS_P_H
@@ -28,6 +28,7 @@
 ****************************************************************************/
 
 #include <private/logxlogydomain_p.h>
+#include <private/domaintransforms_p.h>
 #include <private/qabstractaxis_p.h>
 #include <QtCharts/QLogValueAxis>
 #include <QtCore/QtMath>
@@ -188,30 +189,29 @@ QPointF LogXLogYDomain::calculateGeometryPoint(const QPointF &point, bool &ok) c
     return QPointF(x, y);
 }
 
-QList<QPointF> LogXLogYDomain::calculateGeometryPoints(const QList<QPointF> &list) const
+bool LogXLogYDomain::transformGeometryPoints(QPointF *points, qsizetype count) const
 {
     const qreal deltaX = m_size.width() / qAbs(m_logRightX - m_logLeftX);
     const qreal deltaY = m_size.height() / qAbs(m_logRightY - m_logLeftY);
 
-    QList<QPointF> result;
-    result.resize(list.count());
-
-    for (int i = 0; i < list.count(); ++i) {
-        if (list[i].x() > 0 && list[i].y() > 0) {
-            qreal x = ((std::log10(list[i].x()) / std::log10(m_logBaseX)) - m_logLeftX) * deltaX;
-            if (m_reverseX)
-                x = m_size.width() - x;
-            qreal y = ((std::log10(list[i].y()) / std::log10(m_logBaseY)) - m_logLeftY) * deltaY;
-            if (!m_reverseY)
-                y = m_size.height() - y;
-            result[i].setX(x);
-            result[i].setY(y);
-        } else {
-            qWarning() << "Logarithms of zero and negative values are undefined.";
-            return QList<QPointF>();
-        }
+    if (!DomainTransforms::isPositive(points, count, true, true)) {
+        qWarning() << "Logarithms of zero and negative values are undefined.";
+        return false;
     }
-    return result;
+
+    // log(v) / log(base) - logLeft is computed as (log(v) - logLeft * log(base)) / log(base),
+    // so that everything after the logarithm is a single vectorized pass
+    const qreal logBaseX = std::log10(m_logBaseX);
+    const qreal logBaseY = std::log10(m_logBaseY);
+    DomainTransforms::log10(points, count, true, true);
+    const qreal scaleX = deltaX / logBaseX;
+    const qreal scaleY = deltaY / logBaseY;
+    DomainTransforms::scale(points, count,
+                            QPointF(m_logLeftX * logBaseX, m_logLeftY * logBaseY),
+                            m_reverseX ? -scaleX : scaleX, m_reverseY ? scaleY : -scaleY,
+                            QPointF(m_reverseX ? m_size.width() : 0.0,
+                                    m_reverseY ? 0.0 : m_size.height()));
+    return true;
 }
 
 QPointF LogXLogYDomain::calculateDomainPoint(const QPointF &point) const
@@ -66,7 +66,6 @@ public:
 
     QPointF calculateGeometryPoint(const QPointF &point, bool &ok) const override;
     QPointF calculateDomainPoint(const QPointF &point) const override;
-    QList<QPointF> calculateGeometryPoints(const QList<QPointF> &list) const override;
 
     bool attachAxis(QAbstractAxis *axis) override;
     bool detachAxis(QAbstractAxis *axis) override;
@@ -75,6 +74,9 @@ public Q_SLOTS:
     void handleVerticalAxisBaseChanged(qreal baseY);
     void handleHorizontalAxisBaseChanged(qreal baseX);
 
+protected:
+    bool transformGeometryPoints(QPointF *points, qsizetype count) const override;
+
 private:
     qreal m_logLeftX;
     qreal m_logRightX;
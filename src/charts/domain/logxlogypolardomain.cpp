@@ -28,6 +28,7 @@
 ****************************************************************************/
 
 #include <private/logxlogypolardomain_p.h>
+#include <private/domaintransforms_p.h>
 #include <private/qabstractaxis_p.h>
 #include <QtCharts/QLogValueAxis>
 #include <QtCore/QtMath>
@@ -183,6 +184,23 @@ qreal LogXLogYPolarDomain::toRadialCoordinate(qreal value, bool &ok) const
     return retVal;
 }
 
+bool LogXLogYPolarDomain::toPolarCoordinates(QPointF *points, qsizetype count) const
+{
+    if (!DomainTransforms::isPositive(points, count, true, true))
+        return false;
+
+    const qreal logBaseX = std::log10(m_logBaseX);
+    const qreal logBaseY = std::log10(m_logBaseY);
+    const qreal angularTickSpan = 360.0 / qAbs(m_logRightX - m_logLeftX);
+    const qreal radialTickSpan = m_radius / qAbs(m_logOuterY - m_logInnerY);
+    DomainTransforms::log10(points, count, true, true);
+    DomainTransforms::scale(points, count,
+                            QPointF(m_logLeftX * logBaseX, m_logInnerY * logBaseY),
+                            angularTickSpan / logBaseX, radialTickSpan / logBaseY, QPointF());
+    DomainTransforms::clamp(points, count, QPointF(-qInf(), 0.0));
+    return true;
+}
+
 QPointF LogXLogYPolarDomain::calculateDomainPoint(const QPointF &point) const
 {
     if (point == m_center)
@@ -28,6 +28,7 @@
 ****************************************************************************/
 
 #include <private/logxydomain_p.h>
+#include <private/domaintransforms_p.h>
 #include <private/qabstractaxis_p.h>
 #include <QtCharts/QLogValueAxis>
 #include <QtCore/QtMath>
@@ -174,30 +175,27 @@ QPointF LogXYDomain::calculateGeometryPoint(const QPointF &point, bool &ok) cons
     return QPointF(x, y);
 }
 
-QList<QPointF> LogXYDomain::calculateGeometryPoints(const QList<QPointF> &list) const
+bool LogXYDomain::transformGeometryPoints(QPointF *points, qsizetype count) const
 {
     const qreal deltaX = m_size.width() / (m_logRightX - m_logLeftX);
     const qreal deltaY = m_size.height() / (m_maxY - m_minY);
 
-    QList<QPointF> result;
-    result.resize(list.count());
-
-    for (int i = 0; i < list.count(); ++i) {
-        if (list[i].x() > 0) {
-            qreal x = ((std::log10(list[i].x()) / std::log10(m_logBaseX)) - m_logLeftX) * deltaX;
-            if (m_reverseX)
-                x = m_size.width() - x;
-            qreal y = (list[i].y() - m_minY) * deltaY;
-            if (!m_reverseY)
-                y = m_size.height() - y;
-            result[i].setX(x);
-            result[i].setY(y);
-        } else {
-            qWarning() << "Logarithms of zero and negative values are undefined.";
-            return QList<QPointF>();
-        }
+    if (!DomainTransforms::isPositive(points, count, true, false)) {
+        qWarning() << "Logarithms of zero and negative values are undefined.";
+        return false;
     }
-    return result;
+
+    // log(v) / log(base) - logLeft is computed as (log(v) - logLeft * log(base)) / log(base),
+    // so that everything after the logarithm is a single vectorized pass
+    const qreal logBaseX = std::log10(m_logBaseX);
+    DomainTransforms::log10(points, count, true, false);
+    const qreal scaleX = deltaX / logBaseX;
+    const qreal scaleY = deltaY;
+    DomainTransforms::scale(points, count, QPointF(m_logLeftX * logBaseX, m_minY),
+                            m_reverseX ? -scaleX : scaleX, m_reverseY ? scaleY : -scaleY,
+                            QPointF(m_reverseX ? m_size.width() : 0.0,
+                                    m_reverseY ? 0.0 : m_size.height()));
+    return true;
 }
 
 QPointF LogXYDomain::calculateDomainPoint(const QPointF &point) const
@@ -28,6 +28,7 @@
 ****************************************************************************/
 
 #include <private/logxypolardomain_p.h>
+#include <private/domaintransforms_p.h>
 #include <private/qabstractaxis_p.h>
 #include <QtCharts/QLogValueAxis>
 #include <QtCore/QtMath>
@@ -168,6 +169,20 @@ qreal LogXYPolarDomain::toRadialCoordinate(qreal value, bool &ok) const
     return f * m_radius;
 }
 
+bool LogXYPolarDomain::toPolarCoordinates(QPointF *points, qsizetype count) const
+{
+    if (!DomainTransforms::isPositive(points, count, true, false))
+        return false;
+
+    const qreal logBaseX = std::log10(m_logBaseX);
+    const qreal tickSpan = 360.0 / qAbs(m_logRightX - m_logLeftX);
+    DomainTransforms::log10(points, count, true, false);
+    DomainTransforms::clamp(points, count, QPointF(-qInf(), m_minY));
+    DomainTransforms::scale(points, count, QPointF(m_logLeftX * logBaseX, m_minY),
+                            tickSpan / logBaseX, m_radius / (m_maxY - m_minY), QPointF());
+    return true;
+}
+
 QPointF LogXYPolarDomain::calculateDomainPoint(const QPointF &point) const
 {
     if (point == m_center)
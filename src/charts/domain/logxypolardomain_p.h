@@ -75,6 +75,7 @@ public Q_SLOTS:
 protected:
     qreal toAngularCoordinate(qreal value, bool &ok) const override;
     qreal toRadialCoordinate(qreal value, bool &ok) const override;
+    bool toPolarCoordinates(QPointF *points, qsizetype count) const override;
 
 private:
     qreal m_logLeftX;
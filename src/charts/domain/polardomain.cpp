@@ -28,6 +28,7 @@
 ****************************************************************************/
 
 #include <private/polardomain_p.h>
+#include <private/domaintransforms_p.h>
 #include <private/qabstractaxis_p.h>
 #include <QtCore/QtMath>
 
@@ -64,26 +65,23 @@ QPointF PolarDomain::calculateGeometryPoint(const QPointF &point, bool &ok) cons
     }
 }
 
-QList<QPointF> PolarDomain::calculateGeometryPoints(const QList<QPointF> &list) const
+bool PolarDomain::transformGeometryPoints(QPointF *points, qsizetype count) const
 {
-    QList<QPointF> result;
-    result.resize(list.count());
-    bool ok;
-    qreal r = 0.0;
-    qreal a = 0.0;
-
-    for (int i = 0; i < list.count(); ++i) {
-        a = toAngularCoordinate(list[i].x(), ok);
-        if (ok)
-            r = toRadialCoordinate(list[i].y(), ok);
-        if (ok) {
-            result[i] = m_center + polarCoordinateToPoint(a, r);
-        } else {
-            qWarning() << "Logarithm of negative value is undefined. Empty layout returned.";
-            return QList<QPointF>();
-        }
+    if (!toPolarCoordinates(points, count)) {
+        qWarning() << "Logarithm of negative value is undefined. Empty layout returned.";
+        return false;
     }
+    DomainTransforms::polarToCartesian(points, count, m_center);
+    return true;
+}
 
+QList<QPointF> PolarDomain::calculatePolarCoordinates(const QList<QPointF> &points,
+                                                      bool &ok) const
+{
+    QList<QPointF> result = points;
+    ok = toPolarCoordinates(result.data(), result.size());
+    if (!ok)
+        result.clear();
     return result;
 }
 
@@ -55,12 +55,17 @@ public:
     void setSize(const QSizeF &size) override;
 
     QPointF calculateGeometryPoint(const QPointF &point, bool &ok) const override;
-    QList<QPointF> calculateGeometryPoints(const QList<QPointF> &list) const override;
 
     virtual qreal toAngularCoordinate(qreal value, bool &ok) const = 0;
     virtual qreal toRadialCoordinate(qreal value, bool &ok) const = 0;
+    // The (angle, radius) pairs of the points, calculated in one pass
+    QList<QPointF> calculatePolarCoordinates(const QList<QPointF> &points, bool &ok) const;
 
 protected:
+    bool transformGeometryPoints(QPointF *points, qsizetype count) const override;
+    // Bulk version of toAngularCoordinate() and toRadialCoordinate(), replaces the points
+    // with (angle, radius) pairs. Returns false if some point can't be mapped.
+    virtual bool toPolarCoordinates(QPointF *points, qsizetype count) const = 0;
     QPointF polarCoordinateToPoint(qreal angularCoordinate, qreal radialCoordinate) const;
 
     QPointF m_center;
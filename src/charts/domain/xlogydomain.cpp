@@ -28,6 +28,7 @@
 ****************************************************************************/
 
 #include <private/xlogydomain_p.h>
+#include <private/domaintransforms_p.h>
 #include <private/qabstractaxis_p.h>
 #include <QtCharts/QLogValueAxis>
 #include <QtCore/QtMath>
@@ -174,30 +175,27 @@ QPointF XLogYDomain::calculateGeometryPoint(const QPointF &point, bool &ok) cons
     return QPointF(x, y);
 }
 
-QList<QPointF> XLogYDomain::calculateGeometryPoints(const QList<QPointF> &list) const
+bool XLogYDomain::transformGeometryPoints(QPointF *points, qsizetype count) const
 {
     const qreal deltaX = m_size.width() / (m_maxX - m_minX);
     const qreal deltaY = m_size.height() / qAbs(m_logRightY - m_logLeftY);
 
-    QList<QPointF> result;
-    result.resize(list.count());
-
-    for (int i = 0; i < list.count(); ++i) {
-        if (list[i].y() > 0) {
-            qreal x = (list[i].x() - m_minX) * deltaX;
-            if (m_reverseX)
-                x = m_size.width() - x;
-            qreal y = ((std::log10(list[i].y()) / std::log10(m_logBaseY)) - m_logLeftY) * deltaY;
-            if (!m_reverseY)
-                y = m_size.height() - y;
-            result[i].setX(x);
-            result[i].setY(y);
-        } else {
-            qWarning() << "Logarithms of zero and negative values are undefined.";
-            return QList<QPointF>();
-        }
+    if (!DomainTransforms::isPositive(points, count, false, true)) {
+        qWarning() << "Logarithms of zero and negative values are undefined.";
+        return false;
     }
-    return result;
+
+    // log(v) / log(base) - logLeft is computed as (log(v) - logLeft * log(base)) / log(base),
+    // so that everything after the logarithm is a single vectorized pass
+    const qreal logBaseY = std::log10(m_logBaseY);
+    DomainTransforms::log10(points, count, false, true);
+    const qreal scaleX = deltaX;
+    const qreal scaleY = deltaY / logBaseY;
+    DomainTransforms::scale(points, count, QPointF(m_minX, m_logLeftY * logBaseY),
+                            m_reverseX ? -scaleX : scaleX, m_reverseY ? scaleY : -scaleY,
+                            QPointF(m_reverseX ? m_size.width() : 0.0,
+                                    m_reverseY ? 0.0 : m_size.height()));
+    return true;
 }
 
 QPointF XLogYDomain::calculateDomainPoint(const QPointF &point) const
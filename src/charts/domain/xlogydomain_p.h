@@ -66,7 +66,6 @@ public:
 
     QPointF calculateGeometryPoint(const QPointF &point, bool &ok) const override;
     QPointF calculateDomainPoint(const QPointF &point) const override;
-    QList<QPointF> calculateGeometryPoints(const QList<QPointF> &list) const override;
 
     bool attachAxis(QAbstractAxis *axis) override;
     bool detachAxis(QAbstractAxis *axis) override;
@@ -74,6 +73,9 @@ public:
 public Q_SLOTS:
     void handleVerticalAxisBaseChanged(qreal baseY);
 
+protected:
+    bool transformGeometryPoints(QPointF *points, qsizetype count) const override;
+
 private:
     qreal m_logLeftY;
     qreal m_logRightY;
@@ -28,6 +28,7 @@
 ****************************************************************************/
 
 #include <private/xlogypolardomain_p.h>
+#include <private/domaintransforms_p.h>
 #include <private/qabstractaxis_p.h>
 #include <QtCharts/QLogValueAxis>
 #include <QtCore/QtMath>
@@ -167,6 +168,20 @@ qreal XLogYPolarDomain::toRadialCoordinate(qreal value, bool &ok) const
     return retVal;
 }
 
+bool XLogYPolarDomain::toPolarCoordinates(QPointF *points, qsizetype count) const
+{
+    if (!DomainTransforms::isPositive(points, count, false, true))
+        return false;
+
+    const qreal logBaseY = std::log10(m_logBaseY);
+    const qreal tickSpan = m_radius / qAbs(m_logOuterY - m_logInnerY);
+    DomainTransforms::log10(points, count, false, true);
+    DomainTransforms::scale(points, count, QPointF(m_minX, m_logInnerY * logBaseY),
+                            360.0 / (m_maxX - m_minX), tickSpan / logBaseY, QPointF());
+    DomainTransforms::clamp(points, count, QPointF(-qInf(), 0.0));
+    return true;
+}
+
 QPointF XLogYPolarDomain::calculateDomainPoint(const QPointF &point) const
 {
     if (point == m_center)
@@ -28,6 +28,7 @@
 ****************************************************************************/
 
 #include <private/xydomain_p.h>
+#include <private/domaintransforms_p.h>
 #include <private/qabstractaxis_p.h>
 #include <QtCore/QtMath>
 
@@ -170,29 +171,22 @@ QPointF XYDomain::calculateGeometryPoint(const QPointF &point, bool &ok) const
     return QPointF(x, y);
 }
 
-QList<QPointF> XYDomain::calculateGeometryPoints(const QList<QPointF> &list) const
+bool XYDomain::transformGeometryPoints(QPointF *points, qsizetype count) const
 {
     const qreal xd = m_maxX - m_minX;
     const qreal yd = m_maxY - m_minY;
     if (xd == 0.0 || yd == 0.0)
-        return QList<QPointF>();
+        return false;
     const qreal deltaX = m_size.width() / xd;
     const qreal deltaY = m_size.height() / yd;
 
-    QList<QPointF> result;
-    result.resize(list.count());
-
-    for (int i = 0; i < list.count(); ++i) {
-        qreal x = (list[i].x() - m_minX) * deltaX;
-        if (m_reverseX)
-            x = m_size.width() - x;
-        qreal y = (list[i].y() - m_minY) * deltaY;
-        if (!m_reverseY)
-            y = m_size.height() - y;
-        result[i].setX(x);
-        result[i].setY(y);
-    }
-    return result;
+    // The reversing is folded into the coefficients, so that all the points go through
+    // a single vectorized pass
+    DomainTransforms::scale(points, count, QPointF(m_minX, m_minY),
+                            m_reverseX ? -deltaX : deltaX, m_reverseY ? deltaY : -deltaY,
+                            QPointF(m_reverseX ? m_size.width() : 0.0,
+                                    m_reverseY ? 0.0 : m_size.height()));
+    return true;
 }
 
 QPointF XYDomain::calculateDomainPoint(const QPointF &point) const
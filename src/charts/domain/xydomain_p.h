@@ -66,7 +66,9 @@ public:
 
     QPointF calculateGeometryPoint(const QPointF &point, bool &ok) const override;
     QPointF calculateDomainPoint(const QPointF &point) const override;
-    QList<QPointF> calculateGeometryPoints(const QList<QPointF> &list) const override;
+
+protected:
+    bool transformGeometryPoints(QPointF *points, qsizetype count) const override;
 };
 
 QT_END_NAMESPACE
@@ -28,6 +28,7 @@
 ****************************************************************************/
 
 #include <private/xypolardomain_p.h>
+#include <private/domaintransforms_p.h>
 #include <private/qabstractaxis_p.h>
 #include <QtCore/QtMath>
 
@@ -161,6 +162,15 @@ qreal XYPolarDomain::toRadialCoordinate(qreal value, bool &ok) const
     return f * m_radius;
 }
 
+bool XYPolarDomain::toPolarCoordinates(QPointF *points, qsizetype count) const
+{
+    // Dont limit the max. The drawing should clip the stuff that goes out of the grid
+    DomainTransforms::clamp(points, count, QPointF(-qInf(), m_minY));
+    DomainTransforms::scale(points, count, QPointF(m_minX, m_minY),
+                            360.0 / (m_maxX - m_minX), m_radius / (m_maxY - m_minY), QPointF());
+    return true;
+}
+
 // operators
 
 bool Q_AUTOTEST_EXPORT operator== (const XYPolarDomain &domain1, const XYPolarDomain &domain2)
@@ -68,6 +68,7 @@ public:
 protected:
     qreal toAngularCoordinate(qreal value, bool &ok) const override;
     qreal toRadialCoordinate(qreal value, bool &ok) const override;
+    bool toPolarCoordinates(QPointF *points, qsizetype count) const override;
 };
 
 QT_END_NAMESPACE
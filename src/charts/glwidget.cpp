@@ -346,27 +346,26 @@ void GLWidget::render(bool selection)
             m_program->setUniformValue(m_minUniformLoc, data->min);
             m_program->setUniformValue(m_deltaUniformLoc, data->delta);
             m_program->setUniformValue(m_matrixUniformLoc, data->matrix);
-            bool dirty = data->dirty;
             if (!vbo) {
                 vbo = new QOpenGLBuffer;
                 m_seriesBufferMap.insert(i.key(), vbo);
                 vbo->create();
-                dirty = true;
+                data->markArrayDirty(0, data->array.size());
             }
             vbo->bind();
-            if (dirty) {
-                vbo->allocate(data->array.constData(), data->array.count() * sizeof(GLfloat));
-                dirty = false;
+            if (data->dirty) {
+                GLXYSeriesDataManager::uploadArray(vbo, data);
+                data->dirty = false;
                 m_selectionRenderNeeded = true;
             }
 
             glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, 0);
             if (data->type == QAbstractSeries::SeriesTypeLine) {
                 glLineWidth(data->width);
-                glDrawArrays(GL_LINE_STRIP, 0, data->array.size() / 2);
+                glDrawArrays(GL_LINE_STRIP, data->bufferOffset / 2, data->array.size() / 2);
             } else { // Scatter
                 m_program->setUniformValue(m_pointSizeUniformLoc, data->width);
-                glDrawArrays(GL_POINTS, 0, data->array.size() / 2);
+                glDrawArrays(GL_POINTS, data->bufferOffset / 2, data->array.size() / 2);
             }
             vbo->release();
         }
@@ -57,6 +57,7 @@ QT_FORWARD_DECLARE_CLASS(QOpenGLShaderProgram)
 QT_BEGIN_NAMESPACE
 
 class GLXYSeriesDataManager;
+struct GLXYSeriesData;
 
 class GLWidget : public QOpenGLWidget, protected QOpenGLFunctions
 {
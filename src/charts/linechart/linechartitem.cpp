@@ -34,6 +34,8 @@
 #include <private/polardomain_p.h>
 #include <private/chartthememanager_p.h>
 #include <private/charttheme_p.h>
+#include <private/xydecimator_p.h>
+#include <QtCore/QtMath>
 #include <QtGui/QPainter>
 #include <QtWidgets/QGraphicsSceneMouseEvent>
 
@@ -42,7 +44,11 @@ QT_BEGIN_NAMESPACE
 LineChartItem::LineChartItem(QLineSeries *series, QGraphicsItem *item)
     : XYChart(series,item),
       m_series(series),
+      m_pathsDirty(false),
+      m_shapeDirty(false),
+      m_decimationMode(QXYSeries::DecimationMode::NoDecimation),
       m_pointsVisible(false),
+      m_lineSuppressed(false),
       m_chartType(QChart::ChartTypeUndefined),
       m_pointLabelsVisible(false),
       m_pointLabelsFormat(series->pointLabelsFormat()),
@@ -68,6 +74,10 @@ LineChartItem::LineChartItem(QLineSeries *series, QGraphicsItem *item)
     connect(series, &QLineSeries::selectedPointsChanged, this, &LineChartItem::handleUpdated);
     QObject::connect(series, &QLineSeries::pointsConfigurationChanged, this,
                      &LineChartItem::handleUpdated);
+    QObject::connect(series, &QLineSeries::decimationModeChanged, this,
+                     &LineChartItem::handleUpdated);
+    QObject::connect(series, &QLineSeries::lightMarkerChanged, this,
+                     &LineChartItem::handleLightMarkerChanged);
 
     handleUpdated();
 }
@@ -77,11 +87,72 @@ QRectF LineChartItem::boundingRect() const
     return m_rect;
 }
 
+// The outline is only stroked when something asks for the shape, hit testing uses
+// collidesWithPath() instead.
 QPainterPath LineChartItem::shape() const
 {
+    if (m_shapeDirty) {
+        m_shapeDirty = false;
+        ensurePaths();
+
+        QPainterPathStroker stroker;
+        // QPainter::drawLine does not respect join styles, for example BevelJoin becomes MiterJoin.
+        // This is why we are prepared for the "worst case" scenario, i.e. use always MiterJoin and
+        // multiply line width with square root of two when defining shape and bounding rectangle.
+        stroker.setWidth(m_linePen.width() * 1.42);
+        stroker.setJoinStyle(Qt::MiterJoin);
+        stroker.setCapStyle(Qt::SquareCap);
+        stroker.setMiterLimit(m_linePen.miterLimit());
+
+        m_shapePath = stroker.createStroke(m_fullPath);
+
+        // For mouse interactivity, we have to add the rects *after* the 'createStroke',
+        // as we don't need the outline - we need it filled up.
+        if (!m_series->lightMarker().isNull()) {
+            const QImage &marker = m_series->lightMarker();
+            // '+1': a margin to guarantee we cover all of the pixmap
+            int markerHalfWidth = (marker.width() / 2) + 1;
+            int markerHalfHeight = (marker.height() / 2) + 1;
+
+            // '+2': see above comment about margin
+            for (const auto &point : qAsConst(m_linePoints)) {
+                m_shapePath.addRect(point.x() - markerHalfWidth,
+                                    point.y() - markerHalfHeight,
+                                    marker.width() + 2, marker.height() + 2);
+            }
+        }
+    }
     return m_shapePath;
 }
 
+// Measures the distance to the segments of the line instead of intersecting the path with
+// the stroked outline, which is expensive to create for long series.
+bool LineChartItem::collidesWithPath(const QPainterPath &path, Qt::ItemSelectionMode mode) const
+{
+    Q_UNUSED(mode);
+
+    if (m_series->useOpenGL())
+        return false;
+
+    const QRectF rect = path.boundingRect();
+    if (!m_rect.intersects(rect.adjusted(-0.5, -0.5, 0.5, 0.5)))
+        return false;
+
+    if (m_segmentIndex.intersects(rect))
+        return true;
+
+    if (!m_series->lightMarker().isNull()) {
+        const QImage &marker = m_series->lightMarker();
+        // '+1': a margin to guarantee we cover all of the pixmap
+        const qreal markerHalfWidth = (marker.width() / 2) + 1;
+        const qreal markerHalfHeight = (marker.height() / 2) + 1;
+        const QRectF area = rect.adjusted(-markerHalfWidth, -markerHalfHeight,
+                                          markerHalfWidth, markerHalfHeight);
+        return !geometryPointsIn(area, lightMarkerCellSize()).isEmpty();
+    }
+    return false;
+}
+
 void LineChartItem::updateGeometry()
 {
     if (m_series->useOpenGL()) {
@@ -97,18 +168,28 @@ void LineChartItem::updateGeometry()
     // Store the points to a local variable so that the old line gets properly cleared
     // when animation starts.
     m_linePoints = geometryPoints();
+    m_decimatedPoints = m_linePoints;
     const QList<QPointF> &points = m_linePoints;
+    // Light markers are independent of the line, so they use all the points
+    m_lightMarkers.setPoints(m_linePoints, geometryOffset(), m_pointsConfiguration,
+                             m_series->lightMarker());
 
     if (points.size() == 0) {
         prepareGeometryChange();
         m_fullPath = QPainterPath();
         m_linePath = QPainterPath();
+        m_polylines.clear();
+        m_pathsDirty = false;
+        m_shapePath = QPainterPath();
+        m_shapeDirty = false;
+        m_segmentIndex.setPath(QPainterPath(), 0.0);
         m_rect = QRect();
         return;
     }
 
     QPainterPath linePath;
     QPainterPath fullPath;
+    bool polyline = false;
     // Use worst case scenario to determine required margin.
     qreal margin = m_linePen.width() * 1.42;
 
@@ -128,7 +209,13 @@ void LineChartItem::updateGeometry()
         qreal minX = domain()->minX();
         qreal maxX = domain()->maxX();
         qreal minY = domain()->minY();
-        QPointF currentSeriesPoint = m_series->at(0);
+        // The geometry may only cover a part of the series
+        const QList<QPointF> seriesPoints = m_series->points().mid(geometryOffset(),
+                                                                    points.size());
+        // See ScatterChartItem::updateGeometry() for explanation why seriesLastIndex is needed
+        const int seriesLastIndex = seriesPoints.size() - 1;
+        const QList<QPointF> polarPoints = polarCoordinates(seriesPoints);
+        QPointF currentSeriesPoint = seriesPoints.at(0);
         QPointF currentGeometryPoint = points.at(0);
         QPointF previousGeometryPoint = points.at(0);
         int size = m_linePen.width();
@@ -153,9 +240,6 @@ void LineChartItem::updateGeometry()
         qreal rightMarginLine = centerPoint.x() + margin;
         qreal horizontal = centerPoint.y();
 
-        // See ScatterChartItem::updateGeometry() for explanation why seriesLastIndex is needed
-        const int seriesLastIndex = m_series->count() - 1;
-
         for (int i = 1; i < points.size(); i++) {
             // Interpolating line fragments would be ugly when thick pen is used,
             // so we work around it by utilizing three separate
@@ -169,7 +253,7 @@ void LineChartItem::updateGeometry()
             // degrees and both of the points are within the margin, one in the top half and one in the
             // bottom half of the chart, the bottom one gets clipped incorrectly.
             // However, this should be rare occurrence in any sensible chart.
-            currentSeriesPoint = m_series->at(qMin(seriesLastIndex, i));
+            currentSeriesPoint = seriesPoints.at(qMin(seriesLastIndex, i));
             currentGeometryPoint = points.at(i);
             pointOffGrid = (currentSeriesPoint.x() < minX || currentSeriesPoint.x() > maxX);
 
@@ -187,15 +271,8 @@ void LineChartItem::updateGeometry()
                     intersectionPoint = QPointF(centerPoint.x(), y);
                 }
 
-                bool dummyOk; // We know points are ok, but this is needed
-                qreal currentAngle = 0;
-                qreal previousAngle = 0;
-                if (const PolarDomain *pd = qobject_cast<const PolarDomain *>(domain())) {
-                    currentAngle = pd->toAngularCoordinate(currentSeriesPoint.x(), dummyOk);
-                    previousAngle = pd->toAngularCoordinate(m_series->at(i - 1).x(), dummyOk);
-                } else {
-                    qWarning() << Q_FUNC_INFO << "Unexpected domain: " << domain();
-                }
+                const qreal currentAngle = polarPoints.at(qMin(seriesLastIndex, i)).x();
+                const qreal previousAngle = polarPoints.at(qMin(seriesLastIndex, i - 1)).x();
                 if ((qAbs(currentAngle - previousAngle) > 180.0)) {
                     // If the angle between two points is over 180 degrees (half X range),
                     // any direct segment between them becomes meaningless.
@@ -295,59 +372,143 @@ void LineChartItem::updateGeometry()
         // outside left/right clip regions at axis boundary still generate hover/click events,
         // because shape doesn't get clipped. It doesn't seem possible to do sensibly.
     } else { // not polar
-        linePath.moveTo(points.at(0));
-        for (int i = 1; i < points.size(); i++)
-            linePath.lineTo(points.at(i));
-        fullPath = linePath;
+        // The line is painted as a polyline, the paths are only created if they are needed.
+        polyline = true;
+
+        if (m_lineSuppressed) {
+            // The edges of areas are neither painted nor hit tested, the area only needs
+            // their points. The area is clipped by itself, so the whole edge is decimated.
+            m_decimatedPoints = XYDecimator::decimate(points, m_decimationMode,
+                                                      domain()->size().width());
+            m_polylines = { QPolygonF(m_decimatedPoints) };
+            m_pathsDirty = true;
+            m_shapePath = QPainterPath();
+            m_shapeDirty = true;
+            m_segmentIndex.setPath(QPainterPath(), 0.0);
+            return;
+        }
     }
 
-    QPainterPathStroker stroker;
-    // QPainter::drawLine does not respect join styles, for example BevelJoin becomes MiterJoin.
-    // This is why we are prepared for the "worst case" scenario, i.e. use always MiterJoin and
-    // multiply line width with square root of two when defining shape and bounding rectangle.
-    stroker.setWidth(margin);
-    stroker.setJoinStyle(Qt::MiterJoin);
-    stroker.setCapStyle(Qt::SquareCap);
-    stroker.setMiterLimit(m_linePen.miterLimit());
-
-    QPainterPath checkShapePath = stroker.createStroke(fullPath);
+    // The shape is stroked lazily in shape() and the line is hit tested analytically, so
+    // only the extents of the stroke are needed here. Half of the margin is the distance
+    // from the line that the stroke covers, and the miters can reach further than that.
+    const qreal tolerance = margin / 2.0;
+    const qreal extent = tolerance * qMax(qreal(M_SQRT2), m_linePen.miterLimit());
+
+    // Cartesian lines are cut to the plot area, with a margin for the pen, so that zooming
+    // in deeply does not create huge polylines and paths. Only the line is decimated, after
+    // it is cut, points, markers and labels still use all points.
+    const QRectF plotRect(QPointF(0, 0), domain()->size());
+    QList<QPolygonF> polylines;
+    QRectF pathRect;
+    if (polyline) {
+        polylines = XYDecimator::decimateClipped(points, m_decimationMode,
+                                                 plotRect.adjusted(-extent - 1, -extent - 1,
+                                                                   extent + 1, extent + 1));
+        for (const QPolygonF &clipped : qAsConst(polylines))
+            pathRect |= clipped.boundingRect();
+    } else {
+        // For the polar paths the ellipses of the points are included
+        pathRect = fullPath.boundingRect() | linePath.boundingRect();
+    }
+    QRectF rect = pathRect.adjusted(-extent, -extent, extent, extent);
 
-    // For mouse interactivity, we have to add the rects *after* the 'createStroke',
-    // as we don't need the outline - we need it filled up.
     if (!m_series->lightMarker().isNull()) {
         const QImage &marker = m_series->lightMarker();
         // '+1': a margin to guarantee we cover all of the pixmap
         int markerHalfWidth = (marker.width() / 2) + 1;
         int markerHalfHeight = (marker.height() / 2) + 1;
-
-        // '+2': see above comment about margin
+        QRectF markerRect;
         for (const auto &point : qAsConst(m_linePoints)) {
-            checkShapePath.addRect(point.x() - markerHalfWidth,
-                                   point.y() - markerHalfHeight,
-                                   marker.width() + 2, marker.height() + 2);
+            markerRect |= QRectF(point.x() - markerHalfWidth, point.y() - markerHalfHeight,
+                                 marker.width() + 2, marker.height() + 2);
         }
+        // Markers are not painted outside of the plot area
+        rect |= markerRect & plotRect.adjusted(-markerHalfWidth, -markerHalfHeight,
+                                               markerHalfWidth, markerHalfHeight);
     }
 
     // Only zoom in if the bounding rects of the paths fit inside int limits. QWidget::update() uses
     // a region that has to be compatible with QRect.
-    if (checkShapePath.boundingRect().height() <= INT_MAX
-            && checkShapePath.boundingRect().width() <= INT_MAX
-            && linePath.boundingRect().height() <= INT_MAX
-            && linePath.boundingRect().width() <= INT_MAX
-            && fullPath.boundingRect().height() <= INT_MAX
-            && fullPath.boundingRect().width() <= INT_MAX) {
+    if (rect.height() <= INT_MAX
+            && rect.width() <= INT_MAX
+            && pathRect.height() <= INT_MAX
+            && pathRect.width() <= INT_MAX) {
         prepareGeometryChange();
 
         m_linePath = linePath;
         m_fullPath = fullPath;
-        m_shapePath = checkShapePath;
-
-        m_rect = m_shapePath.boundingRect();
+        m_polylines = polylines;
+        m_pathsDirty = polyline;
+        m_shapePath = QPainterPath();
+        m_shapeDirty = true;
+        if (polyline)
+            m_segmentIndex.setPolylines(m_polylines, tolerance);
+        else
+            m_segmentIndex.setPath(m_fullPath, tolerance);
+
+        m_rect = rect;
     } else {
         update();
     }
 }
 
+// Returns the (angle, radius) pairs of the series points, calculated in one pass by the
+// polar domain, so that the path building doesn't map each angle twice per segment.
+QList<QPointF> LineChartItem::polarCoordinates(const QList<QPointF> &seriesPoints) const
+{
+    const PolarDomain *pd = qobject_cast<const PolarDomain *>(domain());
+    if (!pd) {
+        qWarning() << Q_FUNC_INFO << "Unexpected domain: " << domain();
+        return QList<QPointF>(seriesPoints.size());
+    }
+
+    bool ok;
+    QList<QPointF> polarPoints = pd->calculatePolarCoordinates(seriesPoints, ok);
+    if (!ok) {
+        // Logarithmic domains fail the whole list for a single invalid value,
+        // map the rest of the points one at a time
+        polarPoints.resize(seriesPoints.size());
+        for (int i = 0; i < seriesPoints.size(); ++i)
+            polarPoints[i] = QPointF(pd->toAngularCoordinate(seriesPoints.at(i).x(), ok),
+                                     pd->toRadialCoordinate(seriesPoints.at(i).y(), ok));
+    }
+    return polarPoints;
+}
+
+// Creates the paths of a cartesian line, which is painted from the points as polylines.
+void LineChartItem::ensurePaths() const
+{
+    if (!m_pathsDirty)
+        return;
+    m_pathsDirty = false;
+
+    QPainterPath linePath;
+    for (const QPolygonF &polyline : qAsConst(m_polylines)) {
+        linePath.moveTo(polyline.at(0));
+        for (int i = 1; i < polyline.size(); i++)
+            linePath.lineTo(polyline.at(i));
+    }
+    m_linePath = linePath;
+    m_fullPath = linePath;
+}
+
+QPainterPath LineChartItem::path() const
+{
+    ensurePaths();
+    return m_fullPath;
+}
+
+// Strokes the line in chunks. The raster engine strokes wide pens through an outline of the
+// whole polyline, which gets slow and memory hungry when the polyline has millions of points.
+// Consecutive chunks share their end points, so there are no gaps in the line, although the
+// joins at the chunk boundaries are drawn as caps.
+void LineChartItem::drawPolyline(QPainter *painter, const QPointF *points, int count)
+{
+    for (int first = 0; first < count - 1; first += PolylineChunkSize - 1)
+        painter->drawPolyline(points + first, qMin(PolylineChunkSize, count - first));
+}
+
 void LineChartItem::handleUpdated()
 {
     bool doGeometryUpdate =
@@ -356,7 +517,8 @@ void LineChartItem::handleUpdated()
             && (m_linePen != m_series->pen()
             || m_selectedColor != m_series->selectedColor()
             || m_selectedPoints != m_series->selectedPoints()))
-            || m_series->pointsConfiguration() != m_pointsConfiguration;
+            || m_series->pointsConfiguration() != m_pointsConfiguration
+            || m_series->decimationMode() != m_decimationMode;
     bool visibleChanged = m_series->isVisible() != isVisible();
     setVisible(m_series->isVisible());
     setOpacity(m_series->opacity());
@@ -369,6 +531,7 @@ void LineChartItem::handleUpdated()
     m_selectedColor = m_series->selectedColor();
     m_selectedPoints = m_series->selectedPoints();
     m_pointsConfiguration = m_series->pointsConfiguration();
+    m_decimationMode = m_series->decimationMode();
     bool labelClippingChanged = m_pointLabelsClipping != m_series->pointLabelsClipping();
     m_pointLabelsClipping = m_series->pointLabelsClipping();
     if (doGeometryUpdate)
@@ -383,6 +546,13 @@ void LineChartItem::handleUpdated()
         update();
 }
 
+// The light markers change the bounding rect and the shape of the item as well
+void LineChartItem::handleLightMarkerChanged()
+{
+    updateGeometry();
+    update();
+}
+
 void LineChartItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget)
 {
     Q_UNUSED(widget);
@@ -427,45 +597,23 @@ void LineChartItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *opt
 
     if (m_linePen.style() != Qt::SolidLine || alwaysUsePath) {
         // If pen style is not solid line, use path painting to ensure proper pattern continuity
+        ensurePaths();
         painter->drawPath(m_linePath);
     } else {
-        for (int i = 1; i < m_linePoints.size(); ++i)
-            painter->drawLine(m_linePoints.at(i - 1), m_linePoints.at(i));
+        for (const QPolygonF &polyline : qAsConst(m_polylines))
+            drawPolyline(painter, polyline.constData(), polyline.size());
     }
 
     int pointLabelsOffset = m_linePen.width() / 2;
 
     // Draw markers if a marker has been set (set to QImage() to disable)
     if (!m_series->lightMarker().isNull()) {
-        const QImage &marker = m_series->lightMarker();
-        int markerHalfWidth = marker.width() / 2;
-        int markerHalfHeight = marker.height() / 2;
-        pointLabelsOffset = markerHalfHeight;
-
-        for (int i = 0; i < m_linePoints.size(); ++i) {
-            // Documentation of light markers says that points visibility and
-            // light markers are independent features. Therefore m_pointsVisible
-            // is not used here as light markers are drawn if lightMarker is not null.
-            // However points visibility configuration can be still used here.
-            bool drawPoint = true;
-            if (m_pointsConfiguration.contains(i)) {
-                const auto &conf = m_pointsConfiguration[i];
-
-                if (conf.contains(QXYSeries::PointConfiguration::Visibility)) {
-                    drawPoint = m_pointsConfiguration[i][QXYSeries::PointConfiguration::Visibility]
-                                        .toBool();
-                }
-            }
-
-            if (drawPoint) {
-                painter->drawImage(m_linePoints[i].x() - markerHalfWidth,
-                                   m_linePoints[i].y() - markerHalfHeight,
-                                   marker);
-            }
-        }
+        pointLabelsOffset = m_series->lightMarker().height() / 2;
+        m_lightMarkers.paint(painter, m_series->lightMarker());
     }
 
-    m_series->d_func()->drawPointLabels(painter, m_linePoints, pointLabelsOffset);
+    m_series->d_func()->drawPointLabels(painter, m_linePoints, pointLabelsOffset,
+                                        geometryOffset());
 
     painter->restore();
 
@@ -482,8 +630,10 @@ void LineChartItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *opt
         painter->setPen(Qt::NoPen);
         painter->setBrush(m_linePen.color());
         const qreal defaultPointSize = m_linePen.width() * 1.5;
-        for (int i = 0; i < m_linePoints.size(); ++i) {
-            if (clipRect.contains(m_linePoints.at(i))) {
+        const int offset = geometryOffset();
+        for (int j = 0; j < m_linePoints.size(); ++j) {
+            const int i = offset + j;
+            if (clipRect.contains(m_linePoints.at(j))) {
                 painter->save();
                 ptSize = defaultPointSize;
                 bool drawPoint = m_pointsVisible;
@@ -516,7 +666,7 @@ void LineChartItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *opt
                 }
 
                 if (drawPoint)
-                    painter->drawEllipse(m_linePoints.at(i), ptSize, ptSize);
+                    painter->drawEllipse(m_linePoints.at(j), ptSize, ptSize);
 
                 painter->restore();
             }
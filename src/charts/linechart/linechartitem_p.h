@@ -41,6 +41,8 @@
 
 #include <QtCharts/QChartGlobal>
 #include <private/xychart_p.h>
+#include <private/xylightmarkers_p.h>
+#include <private/xysegmentindex_p.h>
 #include <QtCharts/QChart>
 #include <QtGui/QPen>
 #include <QtCharts/private/qchartglobal_p.h>
@@ -62,11 +64,19 @@ public:
     QRectF boundingRect() const override;
     void paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget) override;
     QPainterPath shape() const override;
+    bool collidesWithPath(const QPainterPath &path,
+                          Qt::ItemSelectionMode mode = Qt::IntersectsItemShape) const override;
 
-    QPainterPath path() const { return m_fullPath; }
+    QPainterPath path() const;
+    // The unclipped points of a cartesian line
+    const QList<QPointF> &linePoints() const { return m_decimatedPoints; }
+
+    static void drawPolyline(QPainter *painter, const QPointF *points, int count);
+    static const int PolylineChunkSize = 1024;
 
 public Q_SLOTS:
     void handleUpdated();
+    void handleLightMarkerChanged();
 
 protected:
     void updateGeometry() override;
@@ -76,20 +86,32 @@ protected:
     void mouseReleaseEvent(QGraphicsSceneMouseEvent *event) override;
     void mouseDoubleClickEvent(QGraphicsSceneMouseEvent *event) override;
     void suppressPoints() { m_pointsVisible = false; }
+    void suppressLine() { m_lineSuppressed = true; }
     void forceChartType(QChart::ChartType chartType) { m_chartType = chartType; }
 
 private:
+    void ensurePaths() const;
+    QList<QPointF> polarCoordinates(const QList<QPointF> &seriesPoints) const;
+
     QLineSeries *m_series;
-    QPainterPath m_linePath;
+    mutable QPainterPath m_linePath;
     QPainterPath m_linePathPolarRight;
     QPainterPath m_linePathPolarLeft;
-    QPainterPath m_fullPath;
-    QPainterPath m_shapePath;
+    mutable QPainterPath m_fullPath;
+    mutable bool m_pathsDirty;
+    mutable QPainterPath m_shapePath;
+    mutable bool m_shapeDirty;
+    mutable XYSegmentIndex m_segmentIndex;
+    XYLightMarkers m_lightMarkers;
 
     QList<QPointF> m_linePoints;
+    QList<QPointF> m_decimatedPoints;
+    QList<QPolygonF> m_polylines;
+    QXYSeries::DecimationMode m_decimationMode;
     QRectF m_rect;
     QPen m_linePen;
     bool m_pointsVisible;
+    bool m_lineSuppressed;
     QChart::ChartType m_chartType;
 
     bool m_pointLabelsVisible;
@@ -37,6 +37,7 @@
 #include <private/charttheme_p.h>
 #include <private/chartpresenter_p.h>
 #include <private/chartdataset_p.h>
+#include <private/xygeometrybatch_p.h>
 #include <QtWidgets/QGraphicsScene>
 #include <QGraphicsSceneResizeEvent>
 
@@ -219,6 +220,61 @@ QT_BEGIN_NAMESPACE
   \sa localizeNumbers
 */
 
+/*!
+  \property QChart::geometryThreadCount
+  \brief The number of threads used to calculate the geometry of the series.
+  \since 6.2
+
+  When the chart is zoomed or scrolled, the geometry of all line, spline, scatter, and area
+  series is calculated together. Large series are split into chunks, which are
+  calculated in parallel on up to this many threads. When the value is \c 1, the
+  work is not split between threads.
+
+  Values less than \c 1 are treated as \c 1. Defaults to QThread::idealThreadCount().
+
+  \sa asynchronousGeometry
+*/
+
+/*!
+  \property QChart::asynchronousGeometry
+  \brief Whether the geometry of the series is calculated asynchronously.
+  \since 6.2
+
+  When \c true, changes to the points of line, spline, scatter, and area series and to
+  their axis ranges do not recalculate the geometry of the series right away. Instead, the
+  geometry is calculated on a worker thread, and the event loop keeps running meanwhile.
+  The chart keeps displaying the previous geometry until the new geometry of all the
+  changed series is ready, and is then updated in one go. Calculations that are
+  outdated by newer changes, for example while zooming quickly with the mouse wheel,
+  are cancelled.
+
+  Only the mapping of the points to positions in the plot area runs on the worker thread.
+  When the new positions are applied, the series still build what they draw from them on the
+  GUI thread. This includes decimating and clipping lines, the control points of splines,
+  and the outlines of areas.
+
+  Series that use OpenGL are not affected. Defaults to \c false.
+
+  \sa geometryThreadCount, coalesceSeriesUpdates
+*/
+
+/*!
+  \property QChart::coalesceSeriesUpdates
+  \brief Whether changes to the points of the series are coalesced into one update per frame.
+  \since 6.2
+
+  When \c true, the line, spline, scatter, and area series of the chart are not updated
+  each time a point is added, removed, or replaced. Instead, the changes are collected, and
+  each changed series is updated once, at most every 16 milliseconds. When only existing
+  points were replaced, only the geometry of the replaced points is recalculated.
+
+  This is useful when the points of the series are changed frequently one at a time, for
+  example when displaying data from a sensor. Series that use OpenGL are not affected.
+  Defaults to \c false.
+
+  \sa asynchronousGeometry
+*/
+
 /*!
   \property QChart::plotArea
   \brief The rectangle within which the chart is drawn.
@@ -670,6 +726,36 @@ QLocale QChart::locale() const
     return d_ptr->m_presenter->locale();
 }
 
+void QChart::setGeometryThreadCount(int count)
+{
+    d_ptr->m_dataset->geometryBatch()->setThreadCount(count);
+}
+
+int QChart::geometryThreadCount() const
+{
+    return d_ptr->m_dataset->geometryBatch()->threadCount();
+}
+
+void QChart::setAsynchronousGeometry(bool asynchronous)
+{
+    d_ptr->m_dataset->geometryBatch()->setAsynchronous(asynchronous);
+}
+
+bool QChart::isAsynchronousGeometry() const
+{
+    return d_ptr->m_dataset->geometryBatch()->isAsynchronous();
+}
+
+void QChart::setCoalesceSeriesUpdates(bool coalesce)
+{
+    d_ptr->m_presenter->setCoalesceSeriesUpdates(coalesce);
+}
+
+bool QChart::coalesceSeriesUpdates() const
+{
+    return d_ptr->m_presenter->coalesceSeriesUpdates();
+}
+
 void QChart::setAnimationOptions(AnimationOptions options)
 {
     d_ptr->m_presenter->setAnimationOptions(options);
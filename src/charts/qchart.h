@@ -64,6 +64,9 @@ class Q_CHARTS_EXPORT QChart : public QGraphicsWidget
     Q_PROPERTY(bool localizeNumbers READ localizeNumbers WRITE setLocalizeNumbers)
     Q_PROPERTY(QLocale locale READ locale WRITE setLocale)
     Q_PROPERTY(QRectF plotArea READ plotArea WRITE setPlotArea NOTIFY plotAreaChanged)
+    Q_PROPERTY(int geometryThreadCount READ geometryThreadCount WRITE setGeometryThreadCount REVISION(6, 2))
+    Q_PROPERTY(bool asynchronousGeometry READ isAsynchronousGeometry WRITE setAsynchronousGeometry REVISION(6, 2))
+    Q_PROPERTY(bool coalesceSeriesUpdates READ coalesceSeriesUpdates WRITE setCoalesceSeriesUpdates REVISION(6, 2))
     Q_ENUMS(ChartTheme)
     Q_ENUMS(AnimationOption)
     Q_ENUMS(ChartType)
@@ -171,6 +174,12 @@ public:
     bool localizeNumbers() const;
     void setLocale(const QLocale &locale);
     QLocale locale() const;
+    void setGeometryThreadCount(int count);
+    int geometryThreadCount() const;
+    void setAsynchronousGeometry(bool asynchronous);
+    bool isAsynchronousGeometry() const;
+    void setCoalesceSeriesUpdates(bool coalesce);
+    bool coalesceSeriesUpdates() const;
 
     QPointF mapToValue(const QPointF &position, QAbstractSeries *series = nullptr);
     QPointF mapToPosition(const QPointF &value, QAbstractSeries *series = nullptr);
@@ -55,6 +55,11 @@
     chart->addSeries(series);
     \endcode
 
+    Series with more than a thousand points don't create a graphics item for each
+    marker. Instead, the markers are painted together from cached images, which keeps
+    large scatter charts responsive. The clicked(), hovered(), pressed(), released(),
+    and doubleClicked() signals are emitted the same way in both cases.
+
     For more information, see \l{ScatterChart Example} and
     \l {Scatter Interactions Example}.
 */
@@ -34,6 +34,8 @@
 #include <private/abstractdomain_p.h>
 #include <QtCharts/QChart>
 #include <QtGui/QPainter>
+#include <QtGui/QPainterPath>
+#include <QtCore/QtMath>
 #include <QtWidgets/QGraphicsScene>
 #include <QtCore/QDebug>
 #include <QtWidgets/QGraphicsSceneMouseEvent>
@@ -42,6 +44,35 @@ QT_BEGIN_NAMESPACE
 
 namespace {
 constexpr short STAR_SPIKES = 5;
+
+QPainterPath markerPath(int shape, qreal size)
+{
+    QPainterPath path;
+    switch (shape) {
+    case QScatterSeries::MarkerShapeCircle:
+        path.addEllipse(0, 0, size, size);
+        break;
+    case QScatterSeries::MarkerShapeRectangle:
+        path.addRect(0, 0, size, size);
+        break;
+    case QScatterSeries::MarkerShapeRotatedRectangle:
+        path.addPolygon(RotatedRectangleMarker::polygon(0, 0, size, size));
+        break;
+    case QScatterSeries::MarkerShapeTriangle:
+        path.addPolygon(TriangleMarker::polygon(0, 0, size, size));
+        break;
+    case QScatterSeries::MarkerShapeStar:
+        path.addPolygon(StarMarker::polygon(0, 0, size, size));
+        break;
+    case QScatterSeries::MarkerShapePentagon:
+        path.addPolygon(PentagonMarker::polygon(0, 0, size, size));
+        break;
+    default:
+        break;
+    }
+    path.closeSubpath();
+    return path;
+}
 }
 
 ScatterChartItem::ScatterChartItem(QScatterSeries *series, QGraphicsItem *item)
@@ -56,7 +87,13 @@ ScatterChartItem::ScatterChartItem(QScatterSeries *series, QGraphicsItem *item)
       m_pointLabelsFont(series->pointLabelsFont()),
       m_pointLabelsColor(series->pointLabelsColor()),
       m_pointLabelsClipping(true),
-      m_mousePressed(false)
+      m_mousePressed(false),
+      m_batched(false),
+      m_maxMarkerSize(15),
+      m_spriteDevicePixelRatio(1.0),
+      m_spriteAntialiasing(false),
+      m_pressedIndex(-1),
+      m_hoveredIndex(-1)
 {
     QObject::connect(m_series->d_func(), SIGNAL(updated()), this, SLOT(handleUpdated()));
     QObject::connect(m_series, SIGNAL(visibleChanged()), this, SLOT(handleUpdated()));
@@ -72,6 +109,8 @@ ScatterChartItem::ScatterChartItem(QScatterSeries *series, QGraphicsItem *item)
     connect(series, &QXYSeries::selectedPointsChanged, this, &ScatterChartItem::handleUpdated);
     QObject::connect(series, &QScatterSeries::pointsConfigurationChanged, this,
                      &ScatterChartItem::handleUpdated);
+    QObject::connect(series, &QScatterSeries::lightMarkerChanged, this,
+                     &ScatterChartItem::handleLightMarkerChanged);
 
     setZValue(ChartPresenter::ScatterSeriesZValue);
     setFlags(QGraphicsItem::ItemClipsChildrenToShape);
@@ -216,12 +255,30 @@ void ScatterChartItem::updateGeometry()
     }
 
     const QList<QPointF> &points = geometryPoints();
+    m_lightMarkers.setPoints(points, geometryOffset(), m_pointsConfiguration,
+                             m_series->lightMarker());
 
     if (points.size() == 0) {
         deletePoints(m_items.childItems().count());
         return;
     }
 
+    const bool wasBatched = m_batched;
+    setBatched(points.size() > BatchThreshold);
+    if (m_batched) {
+        QRectF clipRect(QPointF(0, 0), domain()->size());
+        if (clipRect.height() <= INT_MAX && clipRect.width() <= INT_MAX) {
+            m_offGridStatus = offGridStatusVector();
+            prepareGeometryChange();
+            m_rect = clipRect;
+        }
+        // Picks up the look of the series, like creating the marker items does
+        if (!wasBatched)
+            handleUpdated();
+        update();
+        return;
+    }
+
     int diff = m_items.childItems().size() - points.size();
 
     if (diff > 0)
@@ -242,11 +299,13 @@ void ScatterChartItem::updateGeometry()
             && clipRect.width() <= INT_MAX) {
         const QList<bool> offGridStatus = offGridStatusVector();
         const int seriesLastIndex = m_series->count() - 1;
+        const int offset = geometryOffset();
 
-        for (int i = 0; i < points.size(); i++) {
+        for (int j = 0; j < points.size(); j++) {
             QAbstractGraphicsShapeItem *item =
-                    static_cast<QAbstractGraphicsShapeItem *>(items.at(i));
-            const QPointF &point = points.at(i);
+                    static_cast<QAbstractGraphicsShapeItem *>(items.at(j));
+            const QPointF &point = points.at(j);
+            const int i = offset + j;
 
             if (m_pointsConfiguration.contains(i) && m_pointsConfigurationDirty) {
                 const auto &conf = m_pointsConfiguration[i];
@@ -270,7 +329,7 @@ void ScatterChartItem::updateGeometry()
             position.setY(point.y() - rect.height() / 2);
             item->setPos(position);
 
-            if (!m_visible || offGridStatus.at(i)) {
+            if (!m_visible || offGridStatus.at(j)) {
                 item->setVisible(false);
             } else {
                 bool drawPoint = true;
@@ -299,6 +358,16 @@ void ScatterChartItem::updateGeometry()
     }
 }
 
+void ScatterChartItem::handleLightMarkerChanged()
+{
+    if (m_series->useOpenGL())
+        return;
+
+    m_lightMarkers.setPoints(m_points, m_geometryOffset, m_pointsConfiguration,
+                             m_series->lightMarker());
+    update();
+}
+
 void ScatterChartItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget)
 {
     Q_UNUSED(option);
@@ -308,17 +377,7 @@ void ScatterChartItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *
         return;
 
     // Draw markers if a marker has been set (set to QImage() to disable)
-    if (!m_series->lightMarker().isNull()) {
-        const QImage &marker = m_series->lightMarker();
-        int markerHalfWidth = marker.width() / 2;
-        int markerHalfHeight = marker.height() / 2;
-
-        for (const auto &point : qAsConst(m_points)) {
-            painter->drawImage(point.x() - markerHalfWidth,
-                               point.y() - markerHalfHeight,
-                               marker);
-        }
-    }
+    m_lightMarkers.paint(painter, m_series->lightMarker());
 
     QRectF clipRect = QRectF(QPointF(0, 0), domain()->size());
 
@@ -328,11 +387,224 @@ void ScatterChartItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *
     if (m_series->bestFitLineVisible())
         m_series->d_func()->drawBestFitLine(painter, clipRect);
 
-    m_series->d_func()->drawPointLabels(painter, m_points, m_series->markerSize() / 2 + m_series->pen().width());
+    m_series->d_func()->drawPointLabels(painter, m_points, m_series->markerSize() / 2 + m_series->pen().width(),
+                                        m_geometryOffset);
+
+    // Painted last, like the marker items are painted on top of this item
+    if (m_batched && m_visible)
+        paintMarkers(painter);
 
     painter->restore();
 }
 
+bool ScatterChartItem::collidesWithPath(const QPainterPath &path, Qt::ItemSelectionMode mode) const
+{
+    // Batched markers are only hit where there is a marker, so that the items below get
+    // the mouse events elsewhere in the plot area
+    if (m_batched)
+        return markerAt(path.boundingRect()) >= 0;
+    return XYChart::collidesWithPath(path, mode);
+}
+
+void ScatterChartItem::setBatched(bool batched)
+{
+    if (m_batched == batched)
+        return;
+
+    m_batched = batched;
+    m_sprites.clear();
+    m_offGridStatus.clear();
+    m_pressedIndex = -1;
+    m_hoveredIndex = -1;
+    if (batched)
+        deletePoints(m_items.childItems().count());
+    setAcceptHoverEvents(batched);
+}
+
+// Resolves the size and the color of a marker, returns false if the marker is hidden.
+// An invalid color means that the brush of the series is used.
+bool ScatterChartItem::markerStyle(int index, int &size, QColor &color) const
+{
+    size = m_size;
+    color = QColor();
+    if (!m_selectedPoints.isEmpty() && m_selectedColor.isValid()
+            && m_selectedPoints.contains(index)) {
+        color = m_selectedColor;
+    }
+
+    const auto conf = m_pointsConfiguration.constFind(index);
+    if (conf != m_pointsConfiguration.cend()) {
+        if (!conf->value(QXYSeries::PointConfiguration::Visibility, true).toBool())
+            return false;
+        if (!color.isValid() && conf->contains(QXYSeries::PointConfiguration::Color))
+            color = conf->value(QXYSeries::PointConfiguration::Color).value<QColor>();
+        if (conf->contains(QXYSeries::PointConfiguration::Size))
+            size = conf->value(QXYSeries::PointConfiguration::Size).toInt();
+    }
+    return true;
+}
+
+// Returns the series index of the topmost marker that intersects the rect, or -1
+int ScatterChartItem::markerAt(const QRectF &rect) const
+{
+    const qreal margin = m_maxMarkerSize / 2.0;
+    const QList<int> candidates =
+            geometryPointsIn(rect.adjusted(-margin, -margin, margin, margin), m_maxMarkerSize);
+    int topmost = -1;
+    for (int i : candidates) {
+        if (i <= topmost || (i < m_offGridStatus.size() && m_offGridStatus.at(i)))
+            continue;
+        int size;
+        QColor color;
+        if (!markerStyle(m_geometryOffset + i, size, color))
+            continue;
+        const QPointF &point = m_points.at(i);
+        const QRectF markerRect(point.x() - size / 2.0, point.y() - size / 2.0, size, size);
+        if (markerRect.intersects(rect) || markerRect.contains(rect.topLeft()))
+            topmost = i;
+    }
+    return topmost < 0 ? -1 : m_geometryOffset + topmost;
+}
+
+QPointF ScatterChartItem::seriesPointAt(int index) const
+{
+    // During animations the geometry may have a different number of points
+    return m_series->at(qMin(index, m_series->count() - 1));
+}
+
+void ScatterChartItem::paintMarkers(QPainter *painter)
+{
+    for (int i = 0; i < m_points.size(); ++i) {
+        if (i < m_offGridStatus.size() && m_offGridStatus.at(i))
+            continue;
+        int size;
+        QColor color;
+        if (!markerStyle(m_geometryOffset + i, size, color))
+            continue;
+        const QPixmap sprite = markerSprite(size, color, painter);
+        const qreal half = sprite.width() / sprite.devicePixelRatio() / 2.0;
+        const QPointF &point = m_points.at(i);
+        painter->drawPixmap(QPointF(point.x() - half, point.y() - half), sprite);
+    }
+}
+
+// Markers are rendered once per size and color, and then only blitted. The cache is
+// dropped whenever the look of the series or the target device changes.
+QPixmap ScatterChartItem::markerSprite(int size, const QColor &color, QPainter *painter)
+{
+    const qreal dpr = painter->device() ? painter->device()->devicePixelRatioF() : 1.0;
+    const bool antialiasing = painter->testRenderHint(QPainter::Antialiasing);
+    if (dpr != m_spriteDevicePixelRatio || antialiasing != m_spriteAntialiasing) {
+        m_sprites.clear();
+        m_spriteDevicePixelRatio = dpr;
+        m_spriteAntialiasing = antialiasing;
+    }
+
+    // Markers drawn with the brush of the series use negative sizes as keys
+    const QPair<QRgb, int> key(color.isValid() ? color.rgba() : 0,
+                               color.isValid() ? size : -size - 1);
+    const auto cached = m_sprites.constFind(key);
+    if (cached != m_sprites.cend())
+        return *cached;
+
+    const QPen pen = m_series->pen();
+    const qreal penWidth = pen.style() == Qt::NoPen ? 0.0 : qMax(pen.widthF(), 1.0);
+    const int extent = qCeil((size + penWidth + 2.0) * dpr);
+    QPixmap sprite(extent, extent);
+    sprite.setDevicePixelRatio(dpr);
+    sprite.fill(Qt::transparent);
+
+    QPainter spritePainter(&sprite);
+    spritePainter.setRenderHint(QPainter::Antialiasing, antialiasing);
+    spritePainter.setPen(pen);
+    spritePainter.setBrush(color.isValid() ? QBrush(color) : m_series->brush());
+    const qreal offset = (extent / dpr - size) / 2.0;
+    spritePainter.translate(offset, offset);
+    spritePainter.drawPath(markerPath(m_shape, size));
+    spritePainter.end();
+
+    m_sprites.insert(key, sprite);
+    return sprite;
+}
+
+void ScatterChartItem::updateHoveredMarker(const QPointF &pos)
+{
+    const int index = markerAt(QRectF(pos, QSizeF(1, 1)));
+    if (index == m_hoveredIndex)
+        return;
+
+    if (m_hoveredIndex >= 0)
+        emit XYChart::hovered(m_hoveredPoint, false);
+    m_hoveredIndex = index;
+    if (index >= 0) {
+        m_hoveredPoint = seriesPointAt(index);
+        emit XYChart::hovered(m_hoveredPoint, true);
+    }
+}
+
+void ScatterChartItem::mousePressEvent(QGraphicsSceneMouseEvent *event)
+{
+    if (!m_batched) {
+        XYChart::mousePressEvent(event);
+        return;
+    }
+
+    m_pressedIndex = markerAt(QRectF(event->pos(), QSizeF(1, 1)));
+    if (m_pressedIndex < 0) {
+        event->ignore();
+        return;
+    }
+    emit XYChart::pressed(seriesPointAt(m_pressedIndex));
+    setMousePressed();
+}
+
+void ScatterChartItem::mouseReleaseEvent(QGraphicsSceneMouseEvent *event)
+{
+    if (!m_batched || m_pressedIndex < 0) {
+        XYChart::mouseReleaseEvent(event);
+        return;
+    }
+
+    const QPointF point = seriesPointAt(m_pressedIndex);
+    emit XYChart::released(point);
+    if (mousePressed())
+        emit XYChart::clicked(point);
+    setMousePressed(false);
+    m_pressedIndex = -1;
+}
+
+void ScatterChartItem::mouseDoubleClickEvent(QGraphicsSceneMouseEvent *event)
+{
+    const int index = m_batched ? markerAt(QRectF(event->pos(), QSizeF(1, 1))) : -1;
+    if (index < 0) {
+        XYChart::mouseDoubleClickEvent(event);
+        return;
+    }
+    emit XYChart::doubleClicked(seriesPointAt(index));
+}
+
+void ScatterChartItem::hoverEnterEvent(QGraphicsSceneHoverEvent *event)
+{
+    if (m_batched)
+        updateHoveredMarker(event->pos());
+    XYChart::hoverEnterEvent(event);
+}
+
+void ScatterChartItem::hoverMoveEvent(QGraphicsSceneHoverEvent *event)
+{
+    if (m_batched)
+        updateHoveredMarker(event->pos());
+    XYChart::hoverMoveEvent(event);
+}
+
+void ScatterChartItem::hoverLeaveEvent(QGraphicsSceneHoverEvent *event)
+{
+    if (m_hoveredIndex >= 0)
+        emit XYChart::hovered(m_hoveredPoint, false);
+    m_hoveredIndex = -1;
+    XYChart::hoverLeaveEvent(event);
+}
+
 void ScatterChartItem::setPen(const QPen &pen)
 {
     foreach (QGraphicsItem *item , m_items.childItems())
@@ -376,7 +648,7 @@ void ScatterChartItem::handleUpdated()
     }
 
     int count = m_items.childItems().count();
-    if (count == 0)
+    if (count == 0 && !m_batched)
         return;
 
     m_pointsConfigurationDirty = m_series->pointsConfiguration() != m_pointsConfiguration;
@@ -399,10 +671,20 @@ void ScatterChartItem::handleUpdated()
     m_selectedColor = m_series->selectedColor();
     m_selectedPoints = m_series->selectedPoints();
     m_pointsConfiguration = m_series->pointsConfiguration();
+    m_maxMarkerSize = m_size;
+    for (const auto &conf : qAsConst(m_pointsConfiguration)) {
+        const auto size = conf.constFind(QXYSeries::PointConfiguration::Size);
+        if (size != conf.cend())
+            m_maxMarkerSize = qMax(m_maxMarkerSize, size->toInt());
+    }
     bool labelClippingChanged = m_pointLabelsClipping != m_series->pointLabelsClipping();
     m_pointLabelsClipping = m_series->pointLabelsClipping();
 
-    if (recreate) {
+    if (m_batched) {
+        m_sprites.clear();
+        if (recreate)
+            updateGeometry();
+    } else if (recreate) {
         deletePoints(count);
         createPoints(count);
 
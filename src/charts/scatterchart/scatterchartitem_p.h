@@ -41,8 +41,11 @@
 
 #include <QtCharts/QChartGlobal>
 #include <private/xychart_p.h>
+#include <private/xylightmarkers_p.h>
 #include <QtWidgets/QGraphicsEllipseItem>
 #include <QtGui/QPen>
+#include <QtGui/QPixmap>
+#include <QtCore/QHash>
 #include <QtWidgets/QGraphicsSceneMouseEvent>
 #include <QtCharts/private/qchartglobal_p.h>
 
@@ -61,6 +64,8 @@ public:
     //from QGraphicsItem
     QRectF boundingRect() const override;
     void paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget) override;
+    bool collidesWithPath(const QPainterPath &path,
+                          Qt::ItemSelectionMode mode = Qt::IntersectsItemShape) const override;
 
     void setPen(const QPen &pen);
     void setBrush(const QBrush &brush);
@@ -77,14 +82,29 @@ public:
 
 public Q_SLOTS:
     void handleUpdated();
+    void handleLightMarkerChanged();
 
 private:
     void createPoints(int count);
     void deletePoints(int count);
     void resizeMarker(QGraphicsItem *marker, const int size);
 
+    void setBatched(bool batched);
+    bool markerStyle(int index, int &size, QColor &color) const;
+    int markerAt(const QRectF &rect) const;
+    QPointF seriesPointAt(int index) const;
+    void paintMarkers(QPainter *painter);
+    QPixmap markerSprite(int size, const QColor &color, QPainter *painter);
+    void updateHoveredMarker(const QPointF &pos);
+
 protected:
     void updateGeometry() override;
+    void mousePressEvent(QGraphicsSceneMouseEvent *event) override;
+    void mouseReleaseEvent(QGraphicsSceneMouseEvent *event) override;
+    void mouseDoubleClickEvent(QGraphicsSceneMouseEvent *event) override;
+    void hoverEnterEvent(QGraphicsSceneHoverEvent *event) override;
+    void hoverMoveEvent(QGraphicsSceneHoverEvent *event) override;
+    void hoverLeaveEvent(QGraphicsSceneHoverEvent *event) override;
 
 private:
     QScatterSeries *m_series;
@@ -102,6 +122,22 @@ private:
     bool m_pointLabelsClipping;
 
     bool m_mousePressed;
+
+    // Series with many points don't get an item per marker. Instead, all the markers are
+    // painted by this item from cached sprites, and the markers under the mouse are
+    // looked up from the grid of the geometry points.
+    static const int BatchThreshold = 1000;
+    bool m_batched;
+    int m_maxMarkerSize;
+    QList<bool> m_offGridStatus;
+    QHash<QPair<QRgb, int>, QPixmap> m_sprites;
+    qreal m_spriteDevicePixelRatio;
+    bool m_spriteAntialiasing;
+    int m_pressedIndex;
+    int m_hoveredIndex;
+    QPointF m_hoveredPoint;
+
+    XYLightMarkers m_lightMarkers;
 };
 
 template <class T>
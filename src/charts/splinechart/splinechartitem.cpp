@@ -33,6 +33,7 @@
 #include <private/splineanimation_p.h>
 #include <private/polardomain_p.h>
 #include <QtGui/QPainter>
+#include <algorithm>
 #include <QtWidgets/QGraphicsSceneMouseEvent>
 
 QT_BEGIN_NAMESPACE
@@ -107,6 +108,7 @@ void SplineChartItem::updateChart(const QList<QPointF> &oldPoints, const QList<Q
         m_animation->setup(oldPoints, newPoints, m_controlPoints, controlPoints, index);
 
     m_points = newPoints;
+    m_pointGrid.geometryChanged(++m_geometryRevision);
     m_controlPoints = controlPoints;
     setDirty(false);
 
@@ -336,20 +338,26 @@ void SplineChartItem::updateGeometry()
 
 /*!
   Calculates control points which are needed by QPainterPath.cubicTo function to draw the cubic Bezier cureve between two points.
+
+  The system of equations is solved incrementally: only the rows from the first point that
+  differs from the previous call are eliminated again, and the back substitution stops as
+  soon as the solution no longer changes, as the influence of a point decays by a factor
+  of about 0.27 per point. Appending a point to a long spline therefore only updates its
+  tail. The buffers of the solver are kept between the calls.
   */
 QList<QPointF> SplineChartItem::calculateControlPoints(const QList<QPointF> &points)
 {
-    QList<QPointF> controlPoints;
-    controlPoints.resize(points.count() * 2 - 2);
-
     int n = points.count() - 1;
 
     if (n == 1) {
         //for n==1
+        QList<QPointF> controlPoints(2);
         controlPoints[0].setX((2 * points[0].x() + points[1].x()) / 3);
         controlPoints[0].setY((2 * points[0].y() + points[1].y()) / 3);
         controlPoints[1].setX(2 * controlPoints[0].x() - points[0].x());
         controlPoints[1].setY(2 * controlPoints[0].y() - points[0].y());
+        m_solverPoints.clear();
+        m_solverControlPoints.clear();
         return controlPoints;
     }
 
@@ -365,69 +373,85 @@ QList<QPointF> SplineChartItem::calculateControlPoints(const QList<QPointF> &poi
     //  |   0   0   0   0   0   0   0   0   ... 1   4   1   |   |   P1_(n-1)|   |   4 * P(n-2) + 2 * P(n-1) |
     //  |   0   0   0   0   0   0   0   0   ... 0   2   7   |   |   P1_n    |   |   8 * P(n-1) + Pn         |
     //
-    QList<qreal> list;
-    list.resize(n);
-
-    list[0] = points[0].x() + 2 * points[1].x();
-
-    for (int i = 1; i < n - 1; ++i)
-        list[i] = 4 * points[i].x() + 2 * points[i + 1].x();
-
-    list[n - 1] = (8 * points[n - 1].x() + points[n].x()) / 2.0;
-
-    const QList<qreal> xControl = firstControlPoints(list);
-
-    list[0] = points[0].y() + 2 * points[1].y();
-
-    for (int i = 1; i < n - 1; ++i)
-        list[i] = 4 * points[i].y() + 2 * points[i + 1].y();
-
-    list[n - 1] = (8 * points[n - 1].y() + points[n].y()) / 2.0;
-
-    const QList<qreal> yControl = firstControlPoints(list);
-
-    for (int i = 0, j = 0; i < n; ++i, ++j) {
-
-        controlPoints[j].setX(xControl[i]);
-        controlPoints[j].setY(yControl[i]);
-
-        j++;
-
-        if (i < n - 1) {
-            controlPoints[j].setX(2 * points[i + 1].x() - xControl[i + 1]);
-            controlPoints[j].setY(2 * points[i + 1].y() - yControl[i + 1]);
-        } else {
-            controlPoints[j].setX((points[n].x() + xControl[n - 1]) / 2);
-            controlPoints[j].setY((points[n].y() + yControl[n - 1]) / 2);
-        }
+    // Row i depends on the points i and i + 1, and the last row on the count of the points.
+    int first = 0;
+    const int oldCount = m_solverPoints.count();
+    if (oldCount > 2 && m_solverControlPoints.count() == oldCount * 2 - 2) {
+        const int common = qMin(oldCount, points.count());
+        const int changed = int(std::mismatch(points.cbegin(), points.cbegin() + common,
+                                              m_solverPoints.cbegin()).first - points.cbegin());
+        if (changed == common && oldCount == points.count())
+            return m_solverControlPoints;
+        first = qMax(0, qMin(changed - 1, common - 2));
     }
-    return controlPoints;
+    solveFirstControlPoints(points, first);
+
+    // The control points of segment i depend on the solutions i and i + 1
+    const QList<QPointF> &solution = m_solverSolution;
+    m_solverControlPoints.resize(points.count() * 2 - 2);
+    QPointF *controlPoints = m_solverControlPoints.data();
+    for (int i = qMax(0, first - 1); i < n; ++i) {
+        controlPoints[2 * i] = solution[i];
+        if (i < n - 1)
+            controlPoints[2 * i + 1] = 2 * points[i + 1] - solution[i + 1];
+        else
+            controlPoints[2 * i + 1] = (points[n] + solution[n - 1]) / 2;
+    }
+    m_solverPoints = points;
+    return m_solverControlPoints;
 }
 
-QList<qreal> SplineChartItem::firstControlPoints(const QList<qreal> &list)
+/*!
+  Solves the system of equations for both coordinates at once, from the row \a first on.
+  The rows before it are expected to be unchanged since the previous call. On return,
+  \a first is the first row whose solution changed.
+  */
+void SplineChartItem::solveFirstControlPoints(const QList<QPointF> &points, int &first)
 {
-    QList<qreal> result;
-
-    int count = list.count();
-    result.resize(count);
-    result[0] = list[0] / 2.0;
-
-    QList<qreal> temp;
-    temp.resize(count);
-    temp[0] = 0;
-
+    const int n = points.count() - 1;
+    const int oldCount = m_solverSolution.count();
+    m_solverTemp.resize(n);
+    m_solverForward.resize(n);
+    m_solverSolution.resize(n);
+    qreal *temp = m_solverTemp.data();
+    QPointF *forward = m_solverForward.data();
+    QPointF *solution = m_solverSolution.data();
+
+    // Forward elimination
     qreal b = 2.0;
-
-    for (int i = 1; i < count; i++) {
+    int i = first;
+    if (i == 0) {
+        temp[0] = 0;
+        forward[0] = (points[0] + 2 * points[1]) / 2.0;
+        i = 1;
+    } else {
+        b = 1 / temp[i];
+    }
+    for (; i < n - 1; ++i) {
         temp[i] = 1 / b;
-        b = (i < count - 1 ? 4.0 : 3.5) - temp[i];
-        result[i] = (list[i] - result[i - 1]) / b;
+        b = 4.0 - temp[i];
+        forward[i] = (4 * points[i] + 2 * points[i + 1] - forward[i - 1]) / b;
+    }
+    if (i == n - 1) {
+        temp[i] = 1 / b;
+        b = 3.5 - temp[i];
+        forward[i] = ((8 * points[n - 1] + points[n]) / 2.0 - forward[i - 1]) / b;
     }
 
-    for (int i = 1; i < count; i++)
-        result[count - i - 1] -= temp[count - i] * result[count - i];
-
-    return result;
+    // Back substitution, the rows before the first changed one only change through the
+    // solution of the next row
+    const int unchanged = qMin(first, oldCount);
+    solution[n - 1] = forward[n - 1];
+    for (i = n - 2; i >= 0; --i) {
+        const QPointF value = forward[i] - temp[i + 1] * solution[i + 1];
+        if (i < unchanged
+                && qAbs(value.x() - solution[i].x()) < SolverTolerance
+                && qAbs(value.y() - solution[i].y()) < SolverTolerance) {
+            break;
+        }
+        solution[i] = value;
+    }
+    first = i + 1;
 }
 
 //handlers
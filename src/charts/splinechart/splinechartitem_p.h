@@ -71,7 +71,7 @@ public Q_SLOTS:
 protected:
     void updateGeometry() override;
     QList<QPointF> calculateControlPoints(const QList<QPointF> &points);
-    QList<qreal> firstControlPoints(const QList<qreal> &list);
+    void solveFirstControlPoints(const QList<QPointF> &points, int &first);
     void updateChart(const QList<QPointF> &oldPoints, const QList<QPointF> &newPoints, int index) override;
     void mousePressEvent(QGraphicsSceneMouseEvent *event) override;
     void hoverEnterEvent(QGraphicsSceneHoverEvent *event) override;
@@ -80,6 +80,9 @@ protected:
     void mouseDoubleClickEvent(QGraphicsSceneMouseEvent *event) override;
 
 private:
+    // Changes of the solution below this, in pixels, are not propagated further
+    static constexpr qreal SolverTolerance = 1e-6;
+
     QSplineSeries *m_series;
     QPainterPath m_path;
     QPainterPath m_pathPolarRight;
@@ -90,6 +93,12 @@ private:
     QPen m_pointPen;
     bool m_pointsVisible;
     QList<QPointF> m_controlPoints;
+    // Solver state of calculateControlPoints(), reused between the calls
+    QList<QPointF> m_solverPoints;
+    QList<QPointF> m_solverControlPoints;
+    QList<qreal> m_solverTemp;
+    QList<QPointF> m_solverForward;
+    QList<QPointF> m_solverSolution;
     QList<QPointF> m_visiblePoints;
     SplineAnimation *m_animation;
 
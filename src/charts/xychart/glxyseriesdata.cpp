@@ -29,9 +29,13 @@
 
 #include "private/glxyseriesdata_p.h"
 #include "private/abstractdomain_p.h"
+#include "private/qxyseries_p.h"
 #if QT_CONFIG(charts_scatter_chart)
 #include <QtCharts/QScatterSeries>
 #endif
+#ifndef QT_NO_OPENGL
+#include <QtOpenGL/QOpenGLBuffer>
+#endif
 
 QT_BEGIN_NAMESPACE
 
@@ -46,6 +50,93 @@ GLXYSeriesDataManager::~GLXYSeriesDataManager()
     cleanup();
 }
 
+// Writes the vertices of the points in the range to the array, relative to the origin
+static void convertPoints(const QXYSeriesPrivate *series, GLXYSeriesData *data, int index,
+                          int count)
+{
+    const qreal ox = data->origin.x();
+    const qreal oy = data->origin.y();
+
+    float *vertex = data->array.data() + index * 2;
+    if (const XYColumns *columns = series->columns()) {
+        // Read adopted columns directly, without interleaving them first
+        const qreal *x = columns->x();
+        const qreal *y = columns->y();
+        for (int i = index; i < index + count; i++) {
+            *vertex++ = float(x[i] - ox);
+            *vertex++ = float(y[i] - oy);
+        }
+    } else {
+        const QList<QPointF> &seriesPoints = series->seriesPoints();
+        for (int i = index; i < index + count; i++) {
+            const QPointF &point = seriesPoints.at(i);
+            *vertex++ = float(point.x() - ox);
+            *vertex++ = float(point.y() - oy);
+        }
+    }
+}
+
+// Maps the domain to normalized device coordinates in the shaders. The offset of the domain
+// from the origin is calculated in double precision, so that only the distances within the
+// series end up as floats.
+static void applyDomain(GLXYSeriesData *data, const AbstractDomain *domain)
+{
+    const qreal xd = domain->maxX() - domain->minX();
+    const qreal yd = domain->maxY() - domain->minY();
+    if (qFuzzyIsNull(xd) || qFuzzyIsNull(yd))
+        return;
+
+    data->min = QVector2D(float(domain->minX() - data->origin.x()),
+                          float(domain->minY() - data->origin.y()));
+    data->delta = QVector2D(float(xd / 2.0), float(yd / 2.0));
+}
+
+// The vertices lose precision with their distance from the origin. The origin is moved when
+// the domain gets far from it compared with the size of the domain, or when as many points
+// have been removed from the front as are left, as the origin was based on those.
+static bool originOutdated(const GLXYSeriesData *data, const AbstractDomain *domain)
+{
+    if (data->originRemoved > 0 && data->originRemoved >= data->array.size() / 2)
+        return true;
+
+    const qreal xd = domain->maxX() - domain->minX();
+    const qreal yd = domain->maxY() - domain->minY();
+    if (qFuzzyIsNull(xd) || qFuzzyIsNull(yd))
+        return false;
+    const qreal dx = qAbs((domain->minX() + domain->maxX()) / 2.0 - data->origin.x());
+    const qreal dy = qAbs((domain->minY() + domain->maxY()) / 2.0 - data->origin.y());
+    return dx > GLXYSeriesDataManager::OriginRange * xd
+            || dy > GLXYSeriesDataManager::OriginRange * yd;
+}
+
+// Moves the origin to the center of the domain and converts all the points again
+static void rebaseOrigin(const QXYSeriesPrivate *series, GLXYSeriesData *data,
+                         const AbstractDomain *domain)
+{
+    const qreal xd = domain->maxX() - domain->minX();
+    const qreal yd = domain->maxY() - domain->minY();
+    const int count = data->array.size() / 2;
+    if (!qFuzzyIsNull(xd) && !qFuzzyIsNull(yd)) {
+        data->origin = QPointF((domain->minX() + domain->maxX()) / 2.0,
+                               (domain->minY() + domain->maxY()) / 2.0);
+    } else {
+        data->origin = count ? series->seriesPoint(0) : QPointF();
+    }
+    data->originRemoved = 0;
+    convertPoints(series, data, 0, count);
+    applyDomain(data, domain);
+    data->markArrayDirty(0, data->array.size());
+}
+
+static bool hasLogAxis(const QXYSeries *series)
+{
+    foreach (QAbstractAxis* axis, series->attachedAxes()) {
+        if (axis->type() == QAbstractAxis::AxisTypeLogValue)
+            return true;
+    }
+    return false;
+}
+
 void GLXYSeriesDataManager::setPoints(QXYSeries *series, const AbstractDomain *domain)
 {
     GLXYSeriesData *data = m_seriesDataMap.value(series);
@@ -104,7 +195,10 @@ void GLXYSeriesDataManager::setPoints(QXYSeries *series, const AbstractDomain *d
     QMatrix4x4 matrix;
     if (logAxis) {
         // Use domain to resolve geometry points. Not as fast as shaders, but simpler that way
-        QList<QPointF> geometryPoints = domain->calculateGeometryPoints(series->points());
+        const XYColumns *columns = series->d_func()->columns();
+        QList<QPointF> geometryPoints = columns
+                ? domain->calculateGeometryPoints(columns->x(), columns->y(), columns->count())
+                : domain->calculateGeometryPoints(series->points());
         const float height = domain->size().height();
         if (geometryPoints.size()) {
             for (int i = 0; i < count; i++) {
@@ -121,32 +215,167 @@ void GLXYSeriesDataManager::setPoints(QXYSeries *series, const AbstractDomain *d
         }
         data->min = QVector2D(0, 0);
         data->delta = QVector2D(domain->size().width() / 2.0f, domain->size().height() / 2.0f);
+        data->geometryVertices = true;
     } else {
-        // Regular value axes, so we can optimize it a bit.
+        // Regular value axes, so the domain is applied in the shaders. The points are
+        // relative to the first one, to keep the precision of floats with large values.
         if (reverseX)
             matrix.scale(-1.0, 1.0);
         if (reverseY)
             matrix.scale(1.0, -1.0);
 
-        const qreal mx = domain->minX();
-        const qreal my = domain->minY();
-        const qreal xd = domain->maxX() - mx;
-        const qreal yd = domain->maxY() - my;
-
-        if (!qFuzzyIsNull(xd) && !qFuzzyIsNull(yd)) {
-            const QList<QPointF> seriesPoints = series->points();
-            for (const QPointF &point : seriesPoints) {
-                array[index++] = float((point.x() - mx) / xd);
-                array[index++] = float((point.y() - my) / yd);
-            }
-        }
+        if (const XYColumns *columns = series->d_func()->columns())
+            data->origin = count ? QPointF(columns->x()[0], columns->y()[0]) : QPointF();
+        else
+            data->origin = count ? series->at(0) : QPointF();
+        data->originRemoved = 0;
+        data->geometryVertices = false;
+        convertPoints(series->d_func(), data, 0, count);
         data->min = QVector2D(0.0f, 0.0f);
         data->delta = QVector2D(0.5f, 0.5f);
+        applyDomain(data, domain);
     }
     data->matrix = matrix;
+    data->markArrayDirty(0, array.size());
+}
+
+// Panning and zooming with value axes only changes the uniforms, the vertices are kept as is
+void GLXYSeriesDataManager::setDomain(QXYSeries *series, const AbstractDomain *domain)
+{
+    GLXYSeriesData *data = m_seriesDataMap.value(series);
+    if (!data || data->geometryVertices || data->array.size() != series->count() * 2
+            || hasLogAxis(series)) {
+        setPoints(series, domain);
+        return;
+    }
+
+    if (originOutdated(data, domain)) {
+        rebaseOrigin(series->d_func(), data, domain);
+        return;
+    }
+    applyDomain(data, domain);
     data->dirty = true;
 }
 
+// Only converts the inserted block instead of regenerating the whole array. Falls back to
+// setPoints() whenever the existing array can't be reused as is. Only the vertices from the
+// inserted block onwards need to be uploaded again, so appending is cheap.
+void GLXYSeriesDataManager::insertPoints(QXYSeries *series, const AbstractDomain *domain,
+                                         int index, int count)
+{
+    GLXYSeriesData *data = m_seriesDataMap.value(series);
+    if (!data || data->geometryVertices || data->array.size() != (series->count() - count) * 2
+            || hasLogAxis(series)) {
+        setPoints(series, domain);
+        return;
+    }
+
+    QList<float> &array = data->array;
+    array.insert(index * 2, count * 2, 0.0f);
+    if (originOutdated(data, domain)) {
+        rebaseOrigin(series->d_func(), data, domain);
+        return;
+    }
+    convertPoints(series->d_func(), data, index, count);
+    data->markArrayDirty(index * 2, array.size());
+}
+
+void GLXYSeriesDataManager::replacePoints(QXYSeries *series, const AbstractDomain *domain,
+                                          int index, int count)
+{
+    GLXYSeriesData *data = m_seriesDataMap.value(series);
+    if (!data || data->geometryVertices || data->array.size() != series->count() * 2
+            || hasLogAxis(series)) {
+        setPoints(series, domain);
+        return;
+    }
+
+    if (originOutdated(data, domain)) {
+        rebaseOrigin(series->d_func(), data, domain);
+        return;
+    }
+    convertPoints(series->d_func(), data, index, count);
+    data->markArrayDirty(index * 2, (index + count) * 2);
+}
+
+// Removed points only need to be dropped from the array, the remaining vertices stay valid.
+// Removing from the front of a QList doesn't move the remaining data, and the renderer only
+// moves the start of the array in the buffer, which keeps sliding window series cheap.
+// Otherwise the vertices after the removed block have moved, so they are uploaded again.
+void GLXYSeriesDataManager::removePoints(QXYSeries *series, const AbstractDomain *domain,
+                                         int index, int count)
+{
+    GLXYSeriesData *data = m_seriesDataMap.value(series);
+    if (!data || data->array.size() != (series->count() + count) * 2) {
+        setPoints(series, domain);
+        return;
+    }
+
+    data->array.remove(index * 2, count * 2);
+    if (index == 0) {
+        data->removeArrayFront(count * 2);
+        data->originRemoved += count;
+    } else {
+        data->markArrayDirty(index * 2, data->array.size());
+    }
+    if (!data->geometryVertices && originOutdated(data, domain))
+        rebaseOrigin(series->d_func(), data, domain);
+}
+
+// Appending to a series at its capacity evicts the oldest points. The series already holds
+// both changes when that is reported, so they are applied together: the evicted vertices
+// are dropped from the front and only the added block is converted and uploaded.
+void GLXYSeriesDataManager::evictPoints(QXYSeries *series, const AbstractDomain *domain,
+                                        int evicted, int index, int count)
+{
+    GLXYSeriesData *data = m_seriesDataMap.value(series);
+    if (!data || data->geometryVertices
+            || data->array.size() != (series->count() + evicted - count) * 2
+            || hasLogAxis(series)) {
+        setPoints(series, domain);
+        return;
+    }
+
+    QList<float> &array = data->array;
+    array.remove(0, evicted * 2);
+    data->removeArrayFront(evicted * 2);
+    data->originRemoved += evicted;
+    array.insert(index * 2, count * 2, 0.0f);
+    if (originOutdated(data, domain)) {
+        rebaseOrigin(series->d_func(), data, domain);
+        return;
+    }
+    convertPoints(series->d_func(), data, index, count);
+    data->markArrayDirty(index * 2, array.size());
+}
+
+#ifndef QT_NO_OPENGL
+// Only the changed part of the array is written when it still fits in the buffer. The buffer
+// is grown ahead of the array, so that appending points doesn't reallocate it every time.
+// Points removed from the front only move the start of the array in the buffer, until the
+// array reaches the end of the buffer and is written again from the beginning.
+void GLXYSeriesDataManager::uploadArray(QOpenGLBuffer *vbo, GLXYSeriesData *data)
+{
+    const int arraySize = data->array.size() * sizeof(float);
+    const int bufferSize = vbo->size();
+    const int offset = data->bufferOffset + data->arrayRemovedFront;
+    if (offset * int(sizeof(float)) + arraySize > bufferSize || arraySize < bufferSize / 4) {
+        vbo->allocate(arraySize + arraySize / 2);
+        vbo->write(0, data->array.constData(), arraySize);
+        data->bufferOffset = 0;
+    } else {
+        const int begin = qMin(data->arrayDirtyBegin, int(data->array.size()));
+        const int end = qMin(data->arrayDirtyEnd, int(data->array.size()));
+        if (begin < end) {
+            vbo->write((offset + begin) * sizeof(float), data->array.constData() + begin,
+                       (end - begin) * sizeof(float));
+        }
+        data->bufferOffset = offset;
+    }
+    data->clearArrayDirty();
+}
+#endif
+
 void GLXYSeriesDataManager::removeSeries(const QXYSeries *series)
 {
     GLXYSeriesData *data = m_seriesDataMap.take(series);
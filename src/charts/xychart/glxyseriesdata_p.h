@@ -50,30 +50,79 @@
 QT_BEGIN_NAMESPACE
 
 class AbstractDomain;
+class QOpenGLBuffer;
 
 struct GLXYSeriesData {
     QList<float> array;
     bool dirty;
+    // The part of the array that changed since it was last uploaded, as float indexes.
+    // The buffer is only partially rewritten when the array still fits in it.
+    int arrayDirtyBegin = 0;
+    int arrayDirtyEnd = 0;
+    // Floats removed from the front of the array since it was last uploaded. The renderer
+    // moves the start of the array in the buffer past them instead of uploading the
+    // remaining vertices again.
+    int arrayRemovedFront = 0;
+    // The float index of the first vertex in the buffer, managed by the renderer
+    int bufferOffset = 0;
     QVector3D color;
     float width;
     QAbstractSeries::SeriesType type;
     QVector2D min;
     QVector2D delta;
+    // With value axes, the vertices are the values of the points relative to the origin, and
+    // the domain is only applied by min and delta. With log axes, the vertices are geometry
+    // points, and they have to be regenerated when the domain changes.
+    QPointF origin;
+    // Points removed from the front since the origin was set
+    int originRemoved = 0;
+    bool geometryVertices = false;
     bool visible;
     QMatrix4x4 matrix;
 public:
     GLXYSeriesData &operator=(const GLXYSeriesData &data) {
         array = data.array;
         dirty = data.dirty;
+        arrayDirtyBegin = data.arrayDirtyBegin;
+        arrayDirtyEnd = data.arrayDirtyEnd;
+        arrayRemovedFront = data.arrayRemovedFront;
+        bufferOffset = data.bufferOffset;
         color = data.color;
         width = data.width;
         type = data.type;
         min = data.min;
         delta = data.delta;
+        origin = data.origin;
+        originRemoved = data.originRemoved;
+        geometryVertices = data.geometryVertices;
         visible = data.visible;
         matrix = data.matrix;
         return *this;
     }
+    void markArrayDirty(int begin, int end) {
+        if (arrayDirtyBegin < arrayDirtyEnd) {
+            arrayDirtyBegin = qMin(arrayDirtyBegin, begin);
+            arrayDirtyEnd = qMax(arrayDirtyEnd, end);
+        } else {
+            arrayDirtyBegin = begin;
+            arrayDirtyEnd = end;
+        }
+        dirty = true;
+    }
+    // The dirty range moves along with the vertices that remain
+    void removeArrayFront(int count) {
+        if (arrayDirtyBegin < arrayDirtyEnd) {
+            arrayDirtyBegin = qMax(0, arrayDirtyBegin - count);
+            arrayDirtyEnd = qMax(0, arrayDirtyEnd - count);
+        }
+        arrayRemovedFront += count;
+        dirty = true;
+    }
+    void clearArrayDirty() {
+        arrayDirtyBegin = 0;
+        arrayDirtyEnd = 0;
+        arrayRemovedFront = 0;
+    }
 };
 
 typedef QMap<const QXYSeries *, GLXYSeriesData *> GLXYDataMap;
@@ -87,17 +136,34 @@ public:
     ~GLXYSeriesDataManager();
 
     void setPoints(QXYSeries *series, const AbstractDomain *domain);
+    void setDomain(QXYSeries *series, const AbstractDomain *domain);
+    void insertPoints(QXYSeries *series, const AbstractDomain *domain, int index, int count);
+    void replacePoints(QXYSeries *series, const AbstractDomain *domain, int index, int count);
+    void removePoints(QXYSeries *series, const AbstractDomain *domain, int index, int count);
+    void evictPoints(QXYSeries *series, const AbstractDomain *domain, int evicted, int index,
+                     int count);
 
     void removeSeries(const QXYSeries *series);
 
+    // The vertices are rewritten relative to a new origin once the domain is further than
+    // this many domain sizes from the old one
+    static const int OriginRange = 256;
+
     GLXYDataMap &dataMap() { return m_seriesDataMap; }
 
+#ifndef QT_NO_OPENGL
+    // Writes the array to the bound buffer of the series, used by both renderers
+    static void uploadArray(QOpenGLBuffer *vbo, GLXYSeriesData *data);
+#endif
+
     // These functions are needed by qml side, so they must be inline
     bool mapDirty() const { return m_mapDirty; }
     void clearAllDirty() {
         m_mapDirty = false;
-        foreach (GLXYSeriesData *data, m_seriesDataMap.values())
+        foreach (GLXYSeriesData *data, m_seriesDataMap.values()) {
             data->dirty = false;
+            data->clearArrayDirty();
+        }
     }
     void handleAxisReverseChanged(const QList<QAbstractSeries *> &seriesList);
 
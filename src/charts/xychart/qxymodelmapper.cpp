@@ -104,6 +104,7 @@ void QXYModelMapper::setSeries(QXYSeries *series)
     d->initializeXYFromModel();
     // connect the signals from the series
     connect(d->m_series, SIGNAL(pointAdded(int)), d, SLOT(handlePointAdded(int)));
+    connect(d->m_series, SIGNAL(pointsAdded(int,int)), d, SLOT(handlePointsAdded(int,int)));
     connect(d->m_series, SIGNAL(pointRemoved(int)), d, SLOT(handlePointRemoved(int)));
     connect(d->m_series, SIGNAL(pointReplaced(int)), d, SLOT(handlePointReplaced(int)));
     connect(d->m_series, SIGNAL(destroyed()), d, SLOT(handleSeriesDestroyed()));
@@ -307,6 +308,28 @@ void QXYModelMapperPrivate::handlePointAdded(int pointPos)
     blockModelSignals(false);
 }
 
+void QXYModelMapperPrivate::handlePointsAdded(int pointPos, int count)
+{
+    if (m_seriesSignalsBlock)
+        return;
+
+    if (m_count != -1)
+        m_count += count;
+
+    blockModelSignals();
+    if (m_orientation == Qt::Vertical)
+        m_model->insertRows(pointPos + m_first, count);
+    else
+        m_model->insertColumns(pointPos + m_first, count);
+
+    const QList<QPointF> points = m_series->points();
+    for (int i = pointPos; i < pointPos + count; ++i) {
+        setValueToModel(xModelIndex(i), points.at(i).x());
+        setValueToModel(yModelIndex(i), points.at(i).y());
+    }
+    blockModelSignals(false);
+}
+
 void QXYModelMapperPrivate::handlePointRemoved(int pointPos)
 {
     if (m_seriesSignalsBlock)
@@ -36,6 +36,8 @@
 #include <private/charthelpers_p.h>
 #include <private/qchart_p.h>
 #include <QtGui/QPainter>
+#include <QtCore/QTimer>
+#include <algorithm>
 
 QT_BEGIN_NAMESPACE
 
@@ -86,6 +88,27 @@ QT_BEGIN_NAMESPACE
     \sa setPointConfiguration()
 */
 
+/*!
+    \enum QXYSeries::DecimationMode
+
+    This enum value describes how the line of a series is reduced before drawing when
+    the series has many more points than the plot area has pixel columns.
+
+    \value NoDecimation
+           Every point is used for drawing the line. This is the default.
+    \value MinMax
+           Consecutive points that fall into the same pixel column are reduced to the
+           first, lowest, highest, and last of them. The drawn line covers exactly the
+           same pixels as the full data.
+    \value LargestTriangleThreeBuckets
+           The points are reduced to two points per pixel column with the
+           Largest-Triangle-Three-Buckets algorithm, which keeps the visual shape
+           of the data but may cut off isolated extremes.
+
+    \sa decimationMode
+    \since 6.2
+*/
+
 /*!
     \qmlproperty AbstractAxis XYSeries::axisX
     The x-axis used for the series. If you leave both axisX and axisXTop
@@ -208,6 +231,9 @@ QT_BEGIN_NAMESPACE
 
     This property is \c false by default.
 
+    Labels are drawn in the order of the points. A label that would overlap a label
+    drawn before it is left out, so that dense series show readable labels.
+
     \sa pointLabelsFormat, pointLabelsClipping
 */
 /*!
@@ -485,6 +511,21 @@ QT_BEGIN_NAMESPACE
     The corresponding signal handler is \c onPointAdded().
 */
 
+/*!
+    \fn void QXYSeries::pointsAdded(int index, int count)
+    This signal is emitted when the number of points specified by \a count
+    is added starting at the position specified by \a index.
+    \sa append(), appendRange(), insert()
+    \since 6.2
+*/
+/*!
+    \qmlsignal XYSeries::pointsAdded(int index, int count)
+    This signal is emitted when the number of points specified by \a count
+    is added starting at the position specified by \a index.
+
+    The corresponding signal handler is \c onPointsAdded().
+*/
+
 /*!
     \fn void QXYSeries::pointRemoved(int index)
     This signal is emitted when a point is removed from the position specified
@@ -617,19 +658,67 @@ void QXYSeries::append(const QPointF &point)
     Q_D(QXYSeries);
 
     if (isValidValue(point)) {
+        d->detachColumns();
+        d->evictOldestPoints(1);
         d->m_points << point;
+        d->updateXSorted(d->m_points.count() - 1, 1);
+        d->extendBounds(d->m_points.count() - 1, 1);
+        d->m_rangeIndex.pointsAppended(d->m_points, d->m_points.count() - 1);
         emit pointAdded(d->m_points.count() - 1);
+        d->finishEviction(d->m_points.count() - 1, 1);
     }
 }
 
 /*!
    \overload
    Adds the list of data points specified by \a points to the series.
+
+   The points are added in one go and pointsAdded() is emitted once for the
+   whole block, which is much faster than appending the points one by one.
+   \sa pointsAdded()
  */
 void QXYSeries::append(const QList<QPointF> &points)
 {
-    foreach (const QPointF &point , points)
-        append(point);
+    appendRange(points.constData(), points.count());
+}
+
+/*!
+   Adds \a count data points starting at \a points to the series.
+
+   The points are copied into the series in one go and pointsAdded() is
+   emitted once for the whole block. Points with invalid values are skipped.
+   \sa append(), pointsAdded()
+   \since 6.2
+ */
+void QXYSeries::appendRange(const QPointF *points, int count)
+{
+    Q_D(QXYSeries);
+    d->insertPoints(d->pointCount(), points, count);
+}
+
+/*!
+   Returns a producer that feeds points into the series from any thread.
+
+   The points passed to the producer are queued without locking, and are added to
+   the series once per frame in the thread of the series. Each frame results in a
+   single pointsAdded() or pointsReplaced() notification, no matter how many points
+   were queued.
+
+   \sa QXYSeriesProducer
+   \since 6.2
+ */
+QXYSeriesProducer QXYSeries::producer()
+{
+    Q_D(QXYSeries);
+    if (!d->m_producerQueue) {
+        d->m_producerQueue.reset(new XYPointQueue);
+        d->m_producerTimer = new QTimer(d);
+        d->m_producerTimer->setInterval(16);
+        QObject::connect(d->m_producerTimer, &QTimer::timeout,
+                         d, &QXYSeriesPrivate::drainProducerQueue);
+    }
+    d->m_producerTimer->start();
+    return QXYSeriesProducer(d->m_producerQueue);
 }
 
 /*!
@@ -652,7 +741,7 @@ void QXYSeries::replace(qreal oldX, qreal oldY, qreal newX, qreal newY)
 void QXYSeries::replace(const QPointF &oldPoint, const QPointF &newPoint)
 {
     Q_D(QXYSeries);
-    int index = d->m_points.indexOf(oldPoint);
+    int index = d->seriesPoints().indexOf(oldPoint);
     if (index == -1)
         return;
     replace(index, newPoint);
@@ -677,7 +766,12 @@ void QXYSeries::replace(int index, const QPointF &newPoint)
 {
     Q_D(QXYSeries);
     if (isValidValue(newPoint)) {
+        d->detachColumns();
+        d->shrinkBounds(index, 1);
         d->m_points[index] = newPoint;
+        d->updateXSorted(index, 1);
+        d->extendBounds(index, 1);
+        d->m_rangeIndex.pointReplaced(d->m_points, index);
         emit pointReplaced(index);
     }
 }
@@ -692,7 +786,53 @@ void QXYSeries::replace(int index, const QPointF &newPoint)
 void QXYSeries::replace(const QList<QPointF> &points)
 {
     Q_D(QXYSeries);
-    d->m_points = points;
+    d->m_columns.reset();
+    if (d->m_capacity > 0 && points.count() > d->m_capacity)
+        d->m_points = points.mid(points.count() - d->m_capacity);
+    else
+        d->m_points = points;
+    d->m_xSorted = true;
+    d->updateXSorted(0, d->m_points.count());
+    d->m_boundsValid = false;
+    d->m_rangeIndex.invalidate();
+    emit pointsReplaced();
+}
+
+/*!
+  Replaces the current points with \a count points whose x and y values are
+  stored in the separate arrays \a x and \a y.
+
+  The arrays are not copied. The series reads them directly until its points are
+  replaced again or modified, and the arrays must stay valid and unchanged until
+  then. When the series no longer uses the arrays, \a release is called, so
+  that they can be freed. The release function is also called when the series is
+  destroyed. The values must be finite. If the series has a capacity, only the
+  newest points that fit into it are used.
+
+  Keeping the data in separate columns avoids interleaving it into a list of
+  points first, and the geometry of the series is calculated straight from the
+  columns. Calling points() or at() creates a copy of the points on demand, and
+  modifying the series copies the columns into the series, and releases them.
+
+  Emits pointsReplaced().
+  \sa replace(), pointsReplaced()
+  \since 6.2
+*/
+void QXYSeries::adoptColumns(const qreal *x, const qreal *y, int count,
+                             std::function<void()> release)
+{
+    Q_D(QXYSeries);
+    count = qMax(0, count);
+    if (d->m_capacity > 0 && count > d->m_capacity) {
+        x += count - d->m_capacity;
+        y += count - d->m_capacity;
+        count = d->m_capacity;
+    }
+    d->m_columns.reset(new XYColumns(x, y, count, std::move(release)));
+    d->m_points.clear();
+    d->m_xSorted = d->m_columns->isXSorted();
+    d->m_boundsValid = d->m_columns->bounds(d->m_minX, d->m_maxX, d->m_minY, d->m_maxY);
+    d->m_rangeIndex.invalidate();
     emit pointsReplaced();
 }
 
@@ -973,7 +1113,7 @@ void QXYSeries::selectAllPoints()
     Q_D(QXYSeries);
 
     bool callSignal = false;
-    for (int i = 0; i < d->m_points.count(); ++i)
+    for (int i = 0; i < d->pointCount(); ++i)
         d->setPointSelected(i, true, callSignal);
 
     if (callSignal)
@@ -991,7 +1131,7 @@ void QXYSeries::deselectAllPoints()
     Q_D(QXYSeries);
 
     bool callSignal = false;
-    for (int i = 0; i < d->m_points.count(); ++i)
+    for (int i = 0; i < d->pointCount(); ++i)
         d->setPointSelected(i, false, callSignal);
 
     if (callSignal)
@@ -1080,7 +1220,7 @@ void QXYSeries::remove(qreal x, qreal y)
 void QXYSeries::remove(const QPointF &point)
 {
     Q_D(QXYSeries);
-    int index = d->m_points.indexOf(point);
+    int index = d->seriesPoints().indexOf(point);
     if (index == -1)
         return;
     remove(index);
@@ -1093,8 +1233,12 @@ void QXYSeries::remove(const QPointF &point)
 void QXYSeries::remove(int index)
 {
     Q_D(QXYSeries);
+    d->detachColumns();
     deselectPoint(index);
+    d->shrinkBounds(index, 1);
     d->m_points.remove(index);
+    d->updateXSorted(index, 0);
+    d->m_rangeIndex.invalidate();
     emit pointRemoved(index);
 }
 
@@ -1109,6 +1253,7 @@ void QXYSeries::removePoints(int index, int count)
     // remove(qreal, qreal) overload in some implicit casting cases.
     Q_D(QXYSeries);
     if (count > 0) {
+        d->detachColumns();
         if (!d->m_selectedPoints.empty()) {
             QList<int> indexes;
             for (int i = index; i < index + count; ++i)
@@ -1116,7 +1261,10 @@ void QXYSeries::removePoints(int index, int count)
             deselectPoints(indexes);
         }
 
+        d->shrinkBounds(index, count);
         d->m_points.remove(index, count);
+        d->updateXSorted(index, 0);
+        d->m_rangeIndex.invalidate();
         emit pointsRemoved(index, count);
     }
 }
@@ -1130,7 +1278,9 @@ void QXYSeries::insert(int index, const QPointF &point)
 {
     Q_D(QXYSeries);
     if (isValidValue(point)) {
+        d->detachColumns();
         index = qMax(0, qMin(index, d->m_points.size()));
+        index = qMax(0, index - d->evictOldestPoints(1));
 
         if (!d->m_selectedPoints.isEmpty()) {
             // if point was inserted we need to move already selected points by 1
@@ -1150,10 +1300,34 @@ void QXYSeries::insert(int index, const QPointF &point)
         }
 
         d->m_points.insert(index, point);
+        d->updateXSorted(index, 1);
+        d->extendBounds(index, 1);
+        if (index == d->m_points.count() - 1)
+            d->m_rangeIndex.pointsAppended(d->m_points, index);
+        else
+            d->m_rangeIndex.invalidate();
         emit pointAdded(index);
+        d->finishEviction(index, 1);
     }
 }
 
+/*!
+  \overload
+  Inserts the list of data points specified by \a points in the series at the
+  position specified by \a index.
+
+  The points are inserted in one go and pointsAdded() is emitted once for the
+  whole block. Points with invalid values are skipped.
+  \sa pointsAdded()
+  \since 6.2
+*/
+void QXYSeries::insert(int index, const QList<QPointF> &points)
+{
+    Q_D(QXYSeries);
+    d->insertPoints(qMax(0, qMin(index, d->pointCount())), points.constData(),
+                    points.count());
+}
+
 /*!
   Removes all points from the series.
   \sa pointsRemoved()
@@ -1161,7 +1335,7 @@ void QXYSeries::insert(int index, const QPointF &point)
 void QXYSeries::clear()
 {
     Q_D(QXYSeries);
-    removePoints(0, d->m_points.size());
+    removePoints(0, d->pointCount());
 }
 
 /*!
@@ -1170,7 +1344,7 @@ void QXYSeries::clear()
 QList<QPointF> QXYSeries::points() const
 {
     Q_D(const QXYSeries);
-    return d->m_points;
+    return d->seriesPoints();
 }
 
 #if QT_DEPRECATED_SINCE(6, 0)
@@ -1184,7 +1358,7 @@ QList<QPointF> QXYSeries::points() const
 QList<QPointF> QXYSeries::pointsVector() const
 {
     Q_D(const QXYSeries);
-    return d->m_points;
+    return d->seriesPoints();
 }
 #endif
 
@@ -1195,7 +1369,7 @@ QList<QPointF> QXYSeries::pointsVector() const
 const QPointF &QXYSeries::at(int index) const
 {
     Q_D(const QXYSeries);
-    return d->m_points.at(index);
+    return d->seriesPoints().at(index);
 }
 
 /*!
@@ -1204,7 +1378,84 @@ const QPointF &QXYSeries::at(int index) const
 int QXYSeries::count() const
 {
     Q_D(const QXYSeries);
-    return d->m_points.count();
+    return d->pointCount();
+}
+
+/*!
+    \property QXYSeries::capacity
+    \brief The maximum number of data points kept in the series.
+
+    When the capacity is greater than zero, the series works as a sliding window:
+    adding points to a full series removes the oldest points first, and
+    pointsRemoved() is emitted for them before the new points are announced. This
+    keeps the last \c capacity samples of a live data stream without the need to
+    remove old points manually.
+
+    Setting a capacity smaller than the current number of points removes the oldest
+    points right away. The default value, \c 0, means that the number of points is
+    not limited.
+
+    \since 6.2
+*/
+/*!
+    \qmlproperty int XYSeries::capacity
+    The maximum number of data points kept in the series. When the series is full,
+    adding points removes the oldest points first. The default value, \c 0, means
+    that the number of points is not limited.
+*/
+/*!
+    \fn void QXYSeries::capacityChanged(int capacity)
+    This signal is emitted when the capacity of the series changes to \a capacity.
+    \since 6.2
+*/
+void QXYSeries::setCapacity(int capacity)
+{
+    Q_D(QXYSeries);
+    capacity = qMax(0, capacity);
+    if (d->m_capacity != capacity) {
+        d->m_capacity = capacity;
+        d->evictOldestPoints(0);
+        emit capacityChanged(capacity);
+    }
+}
+
+int QXYSeries::capacity() const
+{
+    Q_D(const QXYSeries);
+    return d->m_capacity;
+}
+
+/*!
+    \property QXYSeries::decimationMode
+    \brief The way the line of the series is reduced before drawing.
+
+    With decimation the cost of drawing the line depends on the width of the plot
+    area instead of the number of points in the series. Decimation only affects how
+    the line of a QLineSeries, or the edges of a QAreaSeries, are drawn on a cartesian
+    chart. Points, labels, markers, and the data of the series are not reduced.
+
+    The default value is QXYSeries::DecimationMode::NoDecimation.
+
+    \since 6.2
+*/
+/*!
+    \fn void QXYSeries::decimationModeChanged(QXYSeries::DecimationMode mode)
+    This signal is emitted when the decimation mode of the series changes to \a mode.
+    \since 6.2
+*/
+void QXYSeries::setDecimationMode(DecimationMode mode)
+{
+    Q_D(QXYSeries);
+    if (d->m_decimationMode != mode) {
+        d->m_decimationMode = mode;
+        emit decimationModeChanged(mode);
+    }
+}
+
+QXYSeries::DecimationMode QXYSeries::decimationMode() const
+{
+    Q_D(const QXYSeries);
+    return d->m_decimationMode;
 }
 
 
@@ -1529,10 +1780,37 @@ QXYSeriesPrivate::QXYSeriesPrivate(QXYSeries *q)
       m_pointLabelsColor(QChartPrivate::defaultPen().color()),
       m_pointLabelsClipping(true),
       m_bestFitLinePen(QChartPrivate::defaultPen()),
-      m_bestFitLineVisible(false)
+      m_bestFitLineVisible(false),
+      m_capacity(0),
+      m_pendingEviction(0),
+      m_decimationMode(QXYSeries::DecimationMode::NoDecimation),
+      m_xSorted(true),
+      m_boundsValid(false),
+      m_minX(0),
+      m_maxX(0),
+      m_minY(0),
+      m_maxY(0),
+      m_producerTimer(nullptr)
 {
 }
 
+// Adds the points queued by the producers of the series. The timer is stopped once there
+// are no producers left and everything they queued has been added.
+void QXYSeriesPrivate::drainProducerQueue()
+{
+    Q_Q(QXYSeries);
+    QList<QPointF> points;
+    bool replace = false;
+    if (m_producerQueue->take(points, replace)) {
+        if (replace)
+            q->replace(points);
+        else
+            q->append(points);
+    } else if (!m_producerQueue->hasProducers()) {
+        m_producerTimer->stop();
+    }
+}
+
 void QXYSeriesPrivate::initializeDomain()
 {
     qreal minX(0);
@@ -1540,25 +1818,7 @@ void QXYSeriesPrivate::initializeDomain()
     qreal maxX(1);
     qreal maxY(1);
 
-    Q_Q(QXYSeries);
-
-    const QList<QPointF> &points = q->points();
-
-    if (!points.isEmpty()) {
-        minX = points[0].x();
-        minY = points[0].y();
-        maxX = minX;
-        maxY = minY;
-
-        for (int i = 0; i < points.count(); i++) {
-            qreal x = points[i].x();
-            qreal y = points[i].y();
-            minX = qMin(minX, x);
-            minY = qMin(minY, y);
-            maxX = qMax(maxX, x);
-            maxY = qMax(maxY, y);
-        }
-    }
+    bounds(minX, maxX, minY, maxY);
 
     domain()->setRange(minX, maxX, minY, maxY);
 }
@@ -1602,8 +1862,9 @@ void QXYSeriesPrivate::initializeAnimations(QChart::AnimationOptions options,
     QAbstractSeriesPrivate::initializeAnimations(options, duration, curve);
 }
 
+// The points may only cover a part of the series, starting at the point at firstIndex
 void QXYSeriesPrivate::drawPointLabels(QPainter *painter, const QList<QPointF> &allPoints,
-                                       const int offset)
+                                       const int offset, int firstIndex)
 {
     if (m_pointLabelsVisible || !m_pointsConfiguration.isEmpty()) {
         if (m_pointLabelsClipping)
@@ -1615,7 +1876,7 @@ void QXYSeriesPrivate::drawPointLabels(QPainter *painter, const QList<QPointF> &
         QHash<int, int> offsets;
 
         if (!m_pointsConfiguration.isEmpty()) {
-            for (int i = 0; i < allPoints.size(); ++i) {
+            for (int i = firstIndex; i < firstIndex + allPoints.size(); ++i) {
                 bool drawLabel = m_pointLabelsVisible;
                 if (m_pointsConfiguration.contains(i)) {
                     const auto &conf = m_pointsConfiguration[i];
@@ -1634,13 +1895,13 @@ void QXYSeriesPrivate::drawPointLabels(QPainter *painter, const QList<QPointF> &
             }
         }
 
-        drawSeriesPointLabels(painter, allPoints, offset, offsets, pointsToSkip);
+        drawSeriesPointLabels(painter, allPoints, offset, offsets, pointsToSkip, firstIndex);
     }
 }
 
 void QXYSeriesPrivate::drawSeriesPointLabels(QPainter *painter, const QList<QPointF> &points,
                                              const int offset, const QHash<int, int> &offsets,
-                                             const QList<int> &indexesToSkip)
+                                             const QList<int> &indexesToSkip, int firstIndex)
 {
     if (points.size() == 0)
         return;
@@ -1653,16 +1914,52 @@ void QXYSeriesPrivate::drawSeriesPointLabels(QPainter *painter, const QList<QPoi
     painter->setFont(f);
     painter->setPen(QPen(m_pointLabelsColor));
     QFontMetrics fm(painter->font());
-    // m_points is used for the label here as it has the series point information
+    m_pointLabelCache.setStyle(m_pointLabelsFormat, f, presenter()->locale(),
+                               presenter()->localizeNumbers());
+
+    // Labels that would overlap a label drawn before them are dropped, and labels outside
+    // of the clip are not drawn at all
+    XYPointLabelGrid labelGrid(fm.height());
+    const bool clipped = painter->hasClipping();
+    const QRectF clipRect = clipped ? painter->clipBoundingRect() : QRectF();
+
+    // Points outside of the clip expanded by the largest possible label are skipped without
+    // formatting their labels
+    QRectF labelBounds;
+    if (clipped) {
+        int maxOffset = qAbs(offset);
+        for (int markerOffset : offsets)
+            maxOffset = qMax(maxOffset, qAbs(markerOffset));
+        const qreal xMargin = m_pointLabelCache.maxLabelWidth() / 2;
+        const qreal yMargin = maxOffset + 2 + fm.height();
+        labelBounds = clipRect.adjusted(-xMargin, -yMargin, xMargin, yMargin);
+    }
+
+    // The series points are used for the label here as they have the series point information
     // points variable passed is used for positioning because it has the coordinates
-    const int pointCount = qMin(points.size(), m_points.size());
-    for (int i(0); i < pointCount; i++) {
-        if (indexesToSkip.contains(i))
+    const QList<QPointF> &labelPoints = seriesPoints();
+    const int pointCount = qMin(int(points.size()), int(labelPoints.size()) - firstIndex);
+    // The indexes to skip are in ascending order
+    auto skip = indexesToSkip.cbegin();
+    for (int j(0); j < pointCount; j++) {
+        const int i = firstIndex + j;
+        while (skip != indexesToSkip.cend() && *skip < i)
+            ++skip;
+        if (skip != indexesToSkip.cend() && *skip == i)
             continue;
 
-        QString pointLabel = m_pointLabelsFormat;
-        pointLabel.replace(xPointTag, presenter()->numberToString(m_points.at(i).x()));
-        pointLabel.replace(yPointTag, presenter()->numberToString(m_points.at(i).y()));
+        const QPointF &point = points.at(j);
+        if (clipped && !labelBounds.contains(point))
+            continue;
+
+        const QPointF &labelPoint = labelPoints.at(i);
+        QStaticText pointLabel;
+        if (!m_pointLabelCache.find(labelPoint, pointLabel)) {
+            QString text = m_pointLabelsFormat;
+            text.replace(xPointTag, presenter()->numberToString(labelPoint.x()));
+            text.replace(yPointTag, presenter()->numberToString(labelPoint.y()));
+            pointLabel = m_pointLabelCache.insert(labelPoint, text);
+        }
 
         int currOffset = offset;
         if (offsets.contains(i))
@@ -1671,13 +1968,18 @@ void QXYSeriesPrivate::drawSeriesPointLabels(QPainter *painter, const QList<QPoi
         const int labelOffset = currOffset + 2;
 
         // Position text in relation to the point
-        int pointLabelWidth = fm.horizontalAdvance(pointLabel);
-        QPointF position(points.at(i));
-        position.setX(position.x() - pointLabelWidth / 2);
-        position.setY(position.y() - labelOffset);
+        const qreal pointLabelWidth = pointLabel.size().width();
+        const QRectF labelRect(point.x() - pointLabelWidth / 2,
+                               point.y() - labelOffset - fm.ascent(),
+                               pointLabelWidth, fm.height());
+        if (clipped && !clipRect.intersects(labelRect))
+            continue;
+        if (!labelGrid.place(labelRect))
+            continue;
 
-        painter->drawText(position, pointLabel);
+        painter->drawStaticText(labelRect.topLeft(), pointLabel);
     }
+    m_pointLabelCache.trim(labelPoints.size());
 }
 
 void QXYSeriesPrivate::drawBestFitLine(QPainter *painter, const QRectF &clipRect)
@@ -1725,36 +2027,364 @@ QColor QXYSeries::bestFitLineColor() const
 
 QPair<qreal, qreal> QXYSeriesPrivate::bestFitLineEquation(bool &ok) const
 {
-    if (m_points.count() <= 1) {
+    const QList<QPointF> &points = seriesPoints();
+    if (points.count() <= 1) {
         ok = false;
         return { 0, 0 };
     }
 
     ok = true;
     qreal xSum = 0.0, x2Sum = 0.0, ySum = 0.0, xySum = 0.0;
-    for (const auto &point : m_points) {
+    for (const auto &point : points) {
         xSum += point.x();
         ySum += point.y();
         x2Sum += qPow(point.x(), 2);
         xySum += point.x() * point.y();
     }
 
-    const qreal divisor = m_points.count() * x2Sum - xSum * xSum;
+    const qreal divisor = points.count() * x2Sum - xSum * xSum;
     // To prevent crashes in unusual cases
     if (divisor == 0.0) {
         ok = false;
         return { 0, 0 };
     }
 
-    qreal a = (m_points.count() * xySum - xSum * ySum) / divisor;
+    qreal a = (points.count() * xySum - xSum * ySum) / divisor;
     qreal b = (x2Sum * ySum - xSum * xySum) / divisor;
 
     return { a, b };
 }
 
+// Adopted columns are read only, so they are copied into the points before the series
+// is modified. The columns are released right away.
+void QXYSeriesPrivate::detachColumns()
+{
+    if (!m_columns)
+        return;
+    if (m_points.count() != m_columns->count())
+        m_points = m_columns->mid(0, m_columns->count());
+    m_columns.reset();
+}
+
+// The owner of the adopted columns has written new rows after the current ones, possibly
+// into new arrays that start with the same values. The new arrays are adopted without
+// scanning the old rows again, and only the new rows are reported as added.
+void QXYSeriesPrivate::appendColumns(const qreal *x, const qreal *y, int count,
+                                     std::function<void()> release)
+{
+    Q_Q(QXYSeries);
+    const int oldCount = pointCount();
+    if (!m_columns || count < oldCount || (m_capacity > 0 && count > m_capacity)) {
+        q->adoptColumns(x, y, count, std::move(release));
+        return;
+    }
+
+    const bool cached = m_points.count() == oldCount;
+    m_columns.reset(new XYColumns(x, y, count, std::move(release)));
+    if (count == oldCount)
+        return;
+
+    if (cached)
+        m_points.append(m_columns->mid(oldCount, count - oldCount));
+    else
+        m_points.clear();
+
+    for (int i = qMax(1, oldCount); m_xSorted && i < count; ++i)
+        m_xSorted = x[i] >= x[i - 1];
+
+    int first = oldCount;
+    if (!m_boundsValid && oldCount == 0) {
+        m_minX = m_maxX = x[0];
+        m_minY = m_maxY = y[0];
+        m_boundsValid = true;
+        first = 1;
+    }
+    if (m_boundsValid) {
+        for (int i = first; i < count; ++i) {
+            m_minX = qMin(m_minX, x[i]);
+            m_maxX = qMax(m_maxX, x[i]);
+            m_minY = qMin(m_minY, y[i]);
+            m_maxY = qMax(m_maxY, y[i]);
+        }
+    }
+
+    emit q->pointsAdded(oldCount, count - oldCount);
+}
+
+const QList<QPointF> &QXYSeriesPrivate::seriesPoints() const
+{
+    if (m_columns && m_points.count() != m_columns->count())
+        m_points = m_columns->mid(0, m_columns->count());
+    return m_points;
+}
+
+// Returns a copy of a block of the points, without copying all of the adopted columns
+QList<QPointF> QXYSeriesPrivate::seriesPoints(int index, int count) const
+{
+    if (m_columns)
+        return m_columns->mid(index, count);
+    return m_points.mid(index, count);
+}
+
+// Inserts the valid points of the given range at index, shifts the selected points
+// accordingly and emits pointsAdded() once for the whole block. If the series has a
+// capacity, the oldest points are evicted first to make room for the block.
+void QXYSeriesPrivate::insertPoints(int index, const QPointF *points, int count)
+{
+    Q_Q(QXYSeries);
+    detachColumns();
+
+    QList<QPointF> validPoints;
+    validPoints.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        if (isValidValue(points[i]))
+            validPoints.append(points[i]);
+    }
+
+    // Only the newest points of a block larger than the capacity can be kept
+    if (m_capacity > 0 && validPoints.count() > m_capacity)
+        validPoints.remove(0, validPoints.count() - m_capacity);
+
+    const int added = validPoints.count();
+    if (added == 0)
+        return;
+
+    index = qMax(0, index - evictOldestPoints(added));
+
+    if (!m_selectedPoints.isEmpty()) {
+        QSet<int> selectedAfterInsert;
+        bool callSignal = false;
+        for (const auto &value : qAsConst(m_selectedPoints)) {
+            if (value >= index) {
+                selectedAfterInsert << value + added;
+                callSignal = true;
+            } else {
+                selectedAfterInsert << value;
+            }
+        }
+        m_selectedPoints = selectedAfterInsert;
+        if (callSignal)
+            emit q->selectedPointsChanged();
+    }
+
+    if (index == m_points.count()) {
+        m_points.append(validPoints);
+    } else {
+        // Make room for the whole block with a single move, then fill it in place
+        m_points.insert(index, added, QPointF());
+        std::copy(validPoints.cbegin(), validPoints.cend(), m_points.begin() + index);
+    }
+    updateXSorted(index, added);
+    extendBounds(index, added);
+    if (index + added == m_points.count())
+        m_rangeIndex.pointsAppended(m_points, index);
+    else
+        m_rangeIndex.invalidate();
+
+    emit q->pointsAdded(index, added);
+    finishEviction(index, added);
+}
+
+// Removes as many of the oldest points as needed to fit incoming new points within the
+// capacity of the series. Returns the number of points removed.
+int QXYSeriesPrivate::evictOldestPoints(int incoming)
+{
+    if (m_capacity <= 0)
+        return 0;
+
+    const int count = pointCount();
+    const int evicted = qMin(count + incoming - m_capacity, count);
+    if (evicted <= 0)
+        return 0;
+
+    Q_Q(QXYSeries);
+    if (m_columns) {
+        // Adopted columns are trimmed without copying them, by moving the start of the
+        // arrays like adoptColumns() does. The new columns keep the old ones alive, so the
+        // arrays are released once the trimmed columns are not used anymore.
+        if (!m_selectedPoints.isEmpty()) {
+            QList<int> indexes;
+            for (int i = 0; i < evicted; ++i)
+                indexes << i;
+            q->deselectPoints(indexes);
+        }
+        shrinkBounds(0, evicted);
+        QSharedPointer<XYColumns> columns = m_columns;
+        m_columns.reset(new XYColumns(columns->x() + evicted, columns->y() + evicted,
+                                      count - evicted,
+                                      [columns]() mutable { columns.reset(); }));
+        if (m_points.count() == count)
+            m_points.remove(0, evicted);
+        else
+            m_points.clear();
+        if (incoming > 0)
+            m_pendingEviction = evicted;
+        emit q->pointsRemoved(0, evicted);
+        return evicted;
+    }
+
+    // QList only moves its begin pointer when erasing from the front, so sliding the
+    // window doesn't shift the remaining points. The removal still emits its signals, but
+    // the chart updates its geometry for it together with the points added next.
+    if (incoming > 0)
+        m_pendingEviction = evicted;
+    q->removePoints(0, evicted);
+    return evicted;
+}
+
+// Emits pointsEvicted() once the points that made room for the evicted ones are added
+void QXYSeriesPrivate::finishEviction(int index, int count)
+{
+    if (m_pendingEviction == 0)
+        return;
+    const int evicted = m_pendingEviction;
+    m_pendingEviction = 0;
+    emit pointsEvicted(evicted, index, count);
+}
+
+// Keeps track of whether the x values of the points are in ascending order, which allows
+// calculating the geometry of the visible points only. After a change only the changed
+// block and its neighbours need to be checked. A series that got out of order is not
+// checked again until all of its points are replaced or removed.
+void QXYSeriesPrivate::updateXSorted(int index, int count)
+{
+    if (m_points.isEmpty()) {
+        m_xSorted = true;
+        return;
+    }
+    if (!m_xSorted)
+        return;
+
+    const int last = qMin(int(m_points.count()) - 1, index + count);
+    for (int i = qMax(1, index); i <= last; ++i) {
+        if (m_points.at(i).x() < m_points.at(i - 1).x()) {
+            m_xSorted = false;
+            return;
+        }
+    }
+}
+
+// The bounds of the points are kept up to date as points are added, so that initializing
+// the domain doesn't need to scan all the points. Removing or replacing a point that lies
+// on the bounds invalidates them, and they are rebuilt the next time they are needed.
+void QXYSeriesPrivate::extendBounds(int index, int count)
+{
+    if (!m_boundsValid) {
+        // Bounds can only be started from scratch when the block holds all the points
+        if (count == 0 || count != m_points.count())
+            return;
+        m_minX = m_maxX = m_points.at(index).x();
+        m_minY = m_maxY = m_points.at(index).y();
+        m_boundsValid = true;
+    }
+
+    for (int i = index; i < index + count; ++i) {
+        const QPointF &point = m_points.at(i);
+        m_minX = qMin(m_minX, point.x());
+        m_maxX = qMax(m_maxX, point.x());
+        m_minY = qMin(m_minY, point.y());
+        m_maxY = qMax(m_maxY, point.y());
+    }
+}
+
+// Must be called before the points are removed or replaced
+void QXYSeriesPrivate::shrinkBounds(int index, int count)
+{
+    if (!m_boundsValid)
+        return;
+
+    for (int i = index; i < index + count; ++i) {
+        const QPointF point = seriesPoint(i);
+        if (point.x() == m_minX || point.x() == m_maxX
+                || point.y() == m_minY || point.y() == m_maxY) {
+            m_boundsValid = false;
+            return;
+        }
+    }
+}
+
+bool QXYSeriesPrivate::bounds(qreal &minX, qreal &maxX, qreal &minY, qreal &maxY)
+{
+    if (pointCount() == 0)
+        return false;
+
+    if (!m_boundsValid) {
+        if (m_columns)
+            m_boundsValid = m_columns->bounds(m_minX, m_maxX, m_minY, m_maxY);
+        else
+            extendBounds(0, m_points.count());
+    }
+
+    minX = m_minX;
+    maxX = m_maxX;
+    minY = m_minY;
+    maxY = m_maxY;
+    return true;
+}
+
+// Finds the y range of the points within the given x range. For series sorted by x this
+// takes O(log n) time, otherwise all the points are checked.
+bool QXYSeriesPrivate::visibleRangeY(qreal minX, qreal maxX, qreal &minY, qreal &maxY)
+{
+    if (m_columns) {
+        // There is no range index for adopted columns, but the visible part of the
+        // y column is scanned contiguously
+        const qreal *x = m_columns->x();
+        const qreal *y = m_columns->y();
+        const qsizetype count = m_columns->count();
+        qsizetype first = 0;
+        qsizetype last = count;
+        if (m_xSorted) {
+            first = std::lower_bound(x, x + count, minX) - x;
+            last = std::upper_bound(x + first, x + count, maxX) - x;
+        }
+        bool found = false;
+        for (qsizetype i = first; i < last; ++i) {
+            if (x[i] < minX || x[i] > maxX)
+                continue;
+            if (!found) {
+                minY = maxY = y[i];
+                found = true;
+            } else {
+                minY = qMin(minY, y[i]);
+                maxY = qMax(maxY, y[i]);
+            }
+        }
+        return found;
+    }
+
+    if (m_xSorted) {
+        const auto begin = m_points.cbegin();
+        const auto first = std::lower_bound(begin, m_points.cend(), minX,
+                                            [](const QPointF &point, qreal x) {
+            return point.x() < x;
+        });
+        const auto last = std::upper_bound(first, m_points.cend(), maxX,
+                                           [](qreal x, const QPointF &point) {
+            return x < point.x();
+        });
+        return m_rangeIndex.rangeY(m_points, int(first - begin), int(last - begin) - 1,
+                                   minY, maxY);
+    }
+
+    bool found = false;
+    for (const QPointF &point : qAsConst(m_points)) {
+        if (point.x() < minX || point.x() > maxX)
+            continue;
+        if (!found) {
+            minY = maxY = point.y();
+            found = true;
+        } else {
+            minY = qMin(minY, point.y());
+            maxY = qMax(maxY, point.y());
+        }
+    }
+    return found;
+}
+
 void QXYSeriesPrivate::setPointSelected(int index, bool selected, bool &callSignal)
 {
-    if (index < 0 || index > m_points.count() - 1)
+    if (index < 0 || index > pointCount() - 1)
         return;
 
     if (selected) {
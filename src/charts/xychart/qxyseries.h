@@ -32,10 +32,13 @@
 
 #include <QtCharts/QChartGlobal>
 #include <QtCharts/QAbstractSeries>
+#include <QtCharts/QXYSeriesProducer>
 #include <QtGui/QPen>
 #include <QtGui/QBrush>
 #include <QtGui/QImage>
 
+#include <functional>
+
 QT_BEGIN_NAMESPACE
 class QModelIndex;
 QT_END_NAMESPACE
@@ -58,6 +61,8 @@ class Q_CHARTS_EXPORT QXYSeries : public QAbstractSeries
     Q_PROPERTY(bool pointLabelsClipping READ pointLabelsClipping WRITE setPointLabelsClipping NOTIFY pointLabelsClippingChanged)
     Q_PROPERTY(bool bestFitLineVisible READ bestFitLineVisible WRITE setBestFitLineVisible NOTIFY bestFitLineVisibilityChanged REVISION(6, 2))
     Q_PROPERTY(QColor bestFitLineColor READ bestFitLineColor WRITE setBestFitLineColor NOTIFY bestFitLineColorChanged REVISION(6, 2))
+    Q_PROPERTY(int capacity READ capacity WRITE setCapacity NOTIFY capacityChanged REVISION(6, 2))
+    Q_PROPERTY(DecimationMode decimationMode READ decimationMode WRITE setDecimationMode NOTIFY decimationModeChanged REVISION(6, 2))
 
 protected:
     explicit QXYSeries(QXYSeriesPrivate &d, QObject *parent = nullptr);
@@ -71,11 +76,20 @@ public:
     };
     Q_ENUM(PointConfiguration)
 
+    enum class DecimationMode {
+        NoDecimation = 0,
+        MinMax,
+        LargestTriangleThreeBuckets
+    };
+    Q_ENUM(DecimationMode)
+
 public:
     ~QXYSeries();
     void append(qreal x, qreal y);
     void append(const QPointF &point);
     void append(const QList<QPointF> &points);
+    void appendRange(const QPointF *points, int count);
+    QXYSeriesProducer producer();
     void replace(qreal oldX, qreal oldY, qreal newX, qreal newY);
     void replace(const QPointF &oldPoint, const QPointF &newPoint);
     void replace(int index, qreal newX, qreal newY);
@@ -85,9 +99,15 @@ public:
     void remove(int index);
     void removePoints(int index, int count);
     void insert(int index, const QPointF &point);
+    void insert(int index, const QList<QPointF> &points);
     void clear();
 
     int count() const;
+    void setCapacity(int capacity);
+    int capacity() const;
+
+    void setDecimationMode(DecimationMode mode);
+    DecimationMode decimationMode() const;
     QList<QPointF> points() const;
 #if QT_DEPRECATED_SINCE(6, 0)
     QT_DEPRECATED_X("Use points() instead")
@@ -129,6 +149,8 @@ public:
     bool pointLabelsClipping() const;
 
     void replace(const QList<QPointF> &points);
+    void adoptColumns(const qreal *x, const qreal *y, int count,
+                      std::function<void()> release = nullptr);
 
     bool isPointSelected(int index);
     void selectPoint(int index);
@@ -175,6 +197,9 @@ Q_SIGNALS:
     void pointReplaced(int index);
     void pointRemoved(int index);
     void pointAdded(int index);
+    Q_REVISION(6, 2) void pointsAdded(int index, int count);
+    Q_REVISION(6, 2) void capacityChanged(int capacity);
+    Q_REVISION(6, 2) void decimationModeChanged(QXYSeries::DecimationMode mode);
     void colorChanged(QColor color);
     void selectedColorChanged(const QColor &color);
     void pointsReplaced();
@@ -199,6 +224,9 @@ private:
     friend class QXYLegendMarkerPrivate;
     friend class XYLegendMarker;
     friend class XYChart;
+    friend class QAreaSeriesPrivate;
+    friend class QAreaSeriesStackPrivate;
+    friend class GLXYSeriesDataManager;
 };
 
 QT_END_NAMESPACE
@@ -40,12 +40,17 @@
 #define QXYSERIES_P_H
 
 #include <private/qabstractseries_p.h>
+#include <private/xyrangeindex_p.h>
+#include <private/qxyseriesproducer_p.h>
+#include <private/xycolumns_p.h>
+#include <private/xypointlabels_p.h>
 #include <QtCharts/private/qchartglobal_p.h>
 
 QT_BEGIN_NAMESPACE
 
 class QXYSeries;
 class QAbstractAxis;
+class QTimer;
 
 class Q_CHARTS_PRIVATE_EXPORT QXYSeriesPrivate: public QAbstractSeriesPrivate
 {
@@ -64,22 +69,51 @@ public:
     QAbstractAxis::AxisType defaultAxisType(Qt::Orientation orientation) const override;
     QAbstractAxis* createDefaultAxis(Qt::Orientation orientation) const override;
 
-    void drawPointLabels(QPainter *painter, const QList<QPointF> &allPoints, const int offset = 0);
+    void drawPointLabels(QPainter *painter, const QList<QPointF> &allPoints, const int offset = 0,
+                         int firstIndex = 0);
     void drawSeriesPointLabels(QPainter *painter, const QList<QPointF> &points,
                                const int offset = 0, const QHash<int, int> &offsets = {},
-                               const QList<int> &indexesToSkip = {});
+                               const QList<int> &indexesToSkip = {}, int firstIndex = 0);
 
     void drawBestFitLine(QPainter *painter, const QRectF &clipRect);
     QPair<qreal, qreal> bestFitLineEquation(bool &ok) const;
 
+    const XYColumns *columns() const { return m_columns.data(); }
+    void detachColumns();
+    void appendColumns(const qreal *x, const qreal *y, int count, std::function<void()> release);
+    const QList<QPointF> &seriesPoints() const;
+    QList<QPointF> seriesPoints(int index, int count) const;
+    QPointF seriesPoint(int index) const
+    {
+        return m_columns ? m_columns->at(index) : m_points.at(index);
+    }
+    int pointCount() const { return m_columns ? int(m_columns->count()) : m_points.count(); }
+
+    void insertPoints(int index, const QPointF *points, int count);
+    int evictOldestPoints(int incoming);
+    bool isEvicting() const { return m_pendingEviction > 0; }
+    void finishEviction(int index, int count);
+    void updateXSorted(int index, int count);
+    bool isXSorted() const { return m_xSorted; }
+    void extendBounds(int index, int count);
+    void shrinkBounds(int index, int count);
+    bool bounds(qreal &minX, qreal &maxX, qreal &minY, qreal &maxY);
+    bool visibleRangeY(qreal minX, qreal maxX, qreal &minY, qreal &maxY);
+
     void setPointSelected(int index, bool selected, bool &callSignal);
     bool isPointSelected(int index);
 
 Q_SIGNALS:
     void updated();
+    void pointsEvicted(int evicted, int index, int count);
+
+public Q_SLOTS:
+    void drainProducerQueue();
 
 protected:
-    QList<QPointF> m_points;
+    // While columns are adopted, this is a copy of them made on demand
+    mutable QList<QPointF> m_points;
+    QSharedPointer<XYColumns> m_columns;
     QSet<int> m_selectedPoints;
     QPen m_pen;
     QColor m_selectedColor;
@@ -90,9 +124,22 @@ protected:
     QFont m_pointLabelsFont;
     QColor m_pointLabelsColor;
     bool m_pointLabelsClipping;
+    XYPointLabelCache m_pointLabelCache;
     QImage m_lightMarker;
     QPen m_bestFitLinePen;
     bool m_bestFitLineVisible;
+    int m_capacity;
+    int m_pendingEviction;
+    QXYSeries::DecimationMode m_decimationMode;
+    bool m_xSorted;
+    bool m_boundsValid;
+    qreal m_minX;
+    qreal m_maxX;
+    qreal m_minY;
+    qreal m_maxY;
+    XYRangeIndex m_rangeIndex;
+    QSharedPointer<XYPointQueue> m_producerQueue;
+    QTimer *m_producerTimer;
 
     QHash<int, QHash<QXYSeries::PointConfiguration, QVariant>> m_pointsConfiguration;
 
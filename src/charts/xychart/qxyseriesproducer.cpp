@@ -0,0 +1,313 @@
+/****************************************************************************
+**
+** Copyright (C) 2021 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtCharts/QXYSeriesProducer>
+#include <private/qxyseriesproducer_p.h>
+#include <QtCore/QThread>
+#include <QtCore/QVarLengthArray>
+#include <algorithm>
+#include <limits>
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QXYSeriesProducer
+    \inmodule QtCharts
+    \brief The QXYSeriesProducer class feeds data into an xy series from any thread.
+    \since 6.2
+
+    A producer is obtained with QXYSeries::producer(). The points passed to it are put
+    into a lock-free queue, which can be written to from any number of threads at the
+    same time. The thread of the series takes the queued points once per frame, and adds
+    them to the series in one block with a single change notification. This avoids the
+    cost of sending every sample to the thread of the series through queued signals.
+    Appending single points doesn't allocate memory, unless the thread of the series
+    falls far behind the producers.
+
+    Copies of a producer feed the same series. Producers can outlive their series, in
+    which case the data passed to them is dropped.
+
+    \sa QXYSeries::producer()
+*/
+
+/*!
+    Constructs a null producer, which doesn't feed any series.
+*/
+QXYSeriesProducer::QXYSeriesProducer()
+{
+}
+
+/*!
+    \internal
+*/
+QXYSeriesProducer::QXYSeriesProducer(const QSharedPointer<XYPointQueue> &queue)
+    : d_ptr(queue)
+{
+    if (d_ptr)
+        d_ptr->producerAttached();
+}
+
+/*!
+    Constructs a copy of \a other, which feeds the same series.
+*/
+QXYSeriesProducer::QXYSeriesProducer(const QXYSeriesProducer &other)
+    : d_ptr(other.d_ptr)
+{
+    if (d_ptr)
+        d_ptr->producerAttached();
+}
+
+/*!
+    Makes this producer feed the same series as \a other.
+*/
+QXYSeriesProducer &QXYSeriesProducer::operator=(const QXYSeriesProducer &other)
+{
+    if (d_ptr != other.d_ptr) {
+        if (other.d_ptr)
+            other.d_ptr->producerAttached();
+        if (d_ptr)
+            d_ptr->producerDetached();
+        d_ptr = other.d_ptr;
+    }
+    return *this;
+}
+
+/*!
+    Destroys the producer. Points that were already passed to it are still added to the
+    series.
+*/
+QXYSeriesProducer::~QXYSeriesProducer()
+{
+    if (d_ptr)
+        d_ptr->producerDetached();
+}
+
+/*!
+    Returns \c true if the producer doesn't feed any series.
+*/
+bool QXYSeriesProducer::isNull() const
+{
+    return d_ptr.isNull();
+}
+
+/*!
+    Queues a point with the coordinates \a x and \a y to be appended to the series.
+    This function is thread-safe.
+*/
+void QXYSeriesProducer::append(qreal x, qreal y)
+{
+    append(QPointF(x, y));
+}
+
+/*!
+    Queues \a point to be appended to the series.
+    This function is thread-safe.
+*/
+void QXYSeriesProducer::append(const QPointF &point)
+{
+    if (d_ptr)
+        d_ptr->push(point);
+}
+
+/*!
+    Queues \a points to be appended to the series. Passing the points of a whole block
+    of samples at once is cheaper than appending them one by one.
+    This function is thread-safe.
+*/
+void QXYSeriesProducer::append(const QList<QPointF> &points)
+{
+    if (d_ptr && !points.isEmpty())
+        d_ptr->push(points, false);
+}
+
+/*!
+    Queues \a points to replace all the points of the series. Points queued before
+    this call that have not been added to the series yet are discarded.
+    This function is thread-safe.
+*/
+void QXYSeriesProducer::replace(const QList<QPointF> &points)
+{
+    if (d_ptr)
+        d_ptr->push(points, true);
+}
+
+static QBasicAtomicInteger<quint64> nextQueueId = Q_BASIC_ATOMIC_INITIALIZER(1);
+
+XYPointQueue::XYPointQueue()
+    : m_id(nextQueueId.fetchAndAddRelaxed(1)),
+      m_head(nullptr),
+      m_rings(nullptr),
+      m_sequence(0),
+      m_replaceSequence(0)
+{
+}
+
+XYPointQueue::~XYPointQueue()
+{
+    Node *node = m_head.loadRelaxed();
+    while (node) {
+        Node *next = node->next;
+        delete node;
+        node = next;
+    }
+    Ring *ring = m_rings.loadRelaxed();
+    while (ring) {
+        Ring *next = ring->next;
+        delete ring;
+        ring = next;
+    }
+}
+
+// Returns the ring of the calling thread, which is created the first time the thread
+// pushes a single point. The last ring used by a thread is remembered, so feeding a
+// single series doesn't need to look for the ring.
+XYPointQueue::Ring *XYPointQueue::threadRing()
+{
+    static thread_local quint64 cachedId = 0;
+    static thread_local Ring *cachedRing = nullptr;
+    if (cachedId == m_id)
+        return cachedRing;
+
+    const Qt::HANDLE thread = QThread::currentThreadId();
+    Ring *ring = m_rings.loadAcquire();
+    while (ring && ring->thread != thread)
+        ring = ring->next;
+
+    if (!ring) {
+        ring = new Ring;
+        ring->thread = thread;
+        Ring *first = m_rings.loadRelaxed();
+        do {
+            ring->next = first;
+        } while (!m_rings.testAndSetRelease(first, ring, first));
+    }
+
+    cachedId = m_id;
+    cachedRing = ring;
+    return ring;
+}
+
+void XYPointQueue::push(const QPointF &point)
+{
+    Ring *ring = threadRing();
+    const quint32 head = ring->head.loadRelaxed();
+    if (head - ring->tail.loadAcquire() == RingSize) {
+        push(QList<QPointF>(1, point), false);
+        return;
+    }
+    Sample &sample = ring->samples[head % RingSize];
+    sample.point = point;
+    sample.sequence = m_sequence.fetchAndAddRelaxed(1);
+    ring->head.storeRelease(head + 1);
+}
+
+void XYPointQueue::push(const QList<QPointF> &points, bool replace)
+{
+    Node *node = new Node{nullptr, m_sequence.fetchAndAddRelaxed(1), replace, points};
+    Node *head = m_head.loadRelaxed();
+    do {
+        node->next = head;
+    } while (!m_head.testAndSetRelease(head, node, head));
+}
+
+// Takes all the pushed points in push order. If some of them replace the contents of the
+// series, replace is set and points only contains the points from the last replacement
+// on. Points pushed before a replacement that only show up after it was taken are dropped.
+bool XYPointQueue::take(QList<QPointF> &points, bool &replace)
+{
+    QVarLengthArray<Node *, 16> nodes;
+    for (Node *node = m_head.fetchAndStoreAcquire(nullptr); node; node = node->next)
+        nodes.append(node);
+    std::sort(nodes.begin(), nodes.end(), [](const Node *a, const Node *b) {
+        return a->sequence < b->sequence;
+    });
+
+    struct Segment
+    {
+        Ring *ring;
+        quint32 begin;
+        quint32 end;
+    };
+    QVarLengthArray<Segment, 16> segments;
+    qsizetype count = 0;
+    for (Ring *ring = m_rings.loadAcquire(); ring; ring = ring->next) {
+        const Segment segment = { ring, ring->tail.loadRelaxed(), ring->head.loadAcquire() };
+        if (segment.begin != segment.end) {
+            segments.append(segment);
+            count += segment.end - segment.begin;
+        }
+    }
+    if (nodes.isEmpty() && segments.isEmpty())
+        return false;
+
+    replace = false;
+    for (const Node *node : qAsConst(nodes)) {
+        if (node->replace) {
+            replace = true;
+            m_replaceSequence = node->sequence;
+        }
+        count += node->points.count();
+    }
+
+    // Merge the rings and the nodes by their sequence numbers
+    points.clear();
+    points.reserve(count);
+    qsizetype nodeIndex = 0;
+    forever {
+        Segment *next = nullptr;
+        quint64 sequence = std::numeric_limits<quint64>::max();
+        for (Segment &segment : segments) {
+            if (segment.begin == segment.end)
+                continue;
+            const quint64 s = segment.ring->samples[segment.begin % RingSize].sequence;
+            if (s < sequence) {
+                sequence = s;
+                next = &segment;
+            }
+        }
+        if (nodeIndex < nodes.count() && nodes.at(nodeIndex)->sequence < sequence) {
+            const Node *node = nodes.at(nodeIndex++);
+            if (node->sequence >= m_replaceSequence)
+                points.append(node->points);
+        } else if (next) {
+            if (sequence >= m_replaceSequence)
+                points.append(next->ring->samples[next->begin % RingSize].point);
+            ++next->begin;
+        } else {
+            break;
+        }
+    }
+
+    for (const Segment &segment : qAsConst(segments))
+        segment.ring->tail.storeRelease(segment.end);
+    qDeleteAll(nodes);
+    return true;
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,66 @@
+/****************************************************************************
+**
+** Copyright (C) 2021 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QXYSERIESPRODUCER_H
+#define QXYSERIESPRODUCER_H
+
+#include <QtCharts/QChartGlobal>
+#include <QtCore/QList>
+#include <QtCore/QPointF>
+#include <QtCore/QSharedPointer>
+
+QT_BEGIN_NAMESPACE
+
+class XYPointQueue;
+
+class Q_CHARTS_EXPORT QXYSeriesProducer
+{
+public:
+    QXYSeriesProducer();
+    QXYSeriesProducer(const QXYSeriesProducer &other);
+    QXYSeriesProducer &operator=(const QXYSeriesProducer &other);
+    ~QXYSeriesProducer();
+
+    bool isNull() const;
+
+    void append(qreal x, qreal y);
+    void append(const QPointF &point);
+    void append(const QList<QPointF> &points);
+    void replace(const QList<QPointF> &points);
+
+private:
+    explicit QXYSeriesProducer(const QSharedPointer<XYPointQueue> &queue);
+
+    QSharedPointer<XYPointQueue> d_ptr;
+    friend class QXYSeries;
+};
+
+QT_END_NAMESPACE
+
+#endif // QXYSERIESPRODUCER_H
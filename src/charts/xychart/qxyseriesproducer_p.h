@@ -0,0 +1,115 @@
+/****************************************************************************
+**
+** Copyright (C) 2021 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt Chart API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+
+#ifndef QXYSERIESPRODUCER_P_H
+#define QXYSERIESPRODUCER_P_H
+
+#include <QtCharts/private/qchartglobal_p.h>
+#include <QtCore/QAtomicInt>
+#include <QtCore/QAtomicPointer>
+#include <QtCore/QList>
+#include <QtCore/QPointF>
+
+QT_BEGIN_NAMESPACE
+
+// Queue between the producers of a series and the series itself. Any number of threads
+// can push into it without locking, and the thread of the series takes everything that
+// was pushed in one go.
+//
+// Single points are written into a ring that belongs to the pushing thread, so appending
+// them doesn't allocate. Blocks of points and replacements are kept in nodes of a
+// lock-free stack, which the consumer detaches with a single exchange. Every point and
+// node gets a sequence number from a shared counter, and the consumer merges the rings
+// and the nodes back into push order by it. A ring that is full because the consumer is
+// behind makes its thread fall back to pushing nodes.
+class Q_CHARTS_PRIVATE_EXPORT XYPointQueue
+{
+public:
+    XYPointQueue();
+    ~XYPointQueue();
+
+    void push(const QPointF &point);
+    void push(const QList<QPointF> &points, bool replace);
+    bool take(QList<QPointF> &points, bool &replace);
+
+    void producerAttached() { m_producers.ref(); }
+    void producerDetached() { m_producers.deref(); }
+    bool hasProducers() const { return m_producers.loadRelaxed() > 0; }
+
+private:
+    struct Node
+    {
+        Node *next;
+        quint64 sequence;
+        bool replace;
+        QList<QPointF> points;
+    };
+
+    struct Sample
+    {
+        QPointF point;
+        quint64 sequence;
+    };
+
+    static const quint32 RingSize = 1024;
+
+    // Written by a single thread, and read by the consumer
+    struct Ring
+    {
+        Ring *next;
+        Qt::HANDLE thread;
+        QAtomicInteger<quint32> head;
+        QAtomicInteger<quint32> tail;
+        Sample samples[RingSize];
+    };
+
+    Ring *threadRing();
+
+    const quint64 m_id;
+    QAtomicPointer<Node> m_head;
+    QAtomicPointer<Ring> m_rings;
+    QAtomicInteger<quint64> m_sequence;
+    quint64 m_replaceSequence;
+    QAtomicInt m_producers;
+
+    Q_DISABLE_COPY(XYPointQueue)
+};
+
+QT_END_NAMESPACE
+
+#endif // QXYSERIESPRODUCER_P_H
@@ -34,25 +34,35 @@
 #include <private/abstractdomain_p.h>
 #include <private/chartdataset_p.h>
 #include <private/glxyseriesdata_p.h>
+#include <private/xygeometrybatch_p.h>
 #include <QtCharts/QXYModelMapper>
 #include <private/qabstractaxis_p.h>
 #include <QtGui/QPainter>
 #include <QtCore/QAbstractItemModel>
 
+#include <algorithm>
+
 
 QT_BEGIN_NAMESPACE
 
 XYChart::XYChart(QXYSeries *series, QGraphicsItem *item):
       ChartItem(series->d_func(),item),
       m_series(series),
+      m_geometryOffset(0),
       m_animation(0),
-      m_dirty(true)
+      m_dirty(true),
+      m_geometryRevision(0),
+      m_coalescedUpdatePending(false),
+      m_coalescedFullUpdate(false)
 {
     QObject::connect(series, SIGNAL(pointReplaced(int)), this, SLOT(handlePointReplaced(int)));
     QObject::connect(series, SIGNAL(pointsReplaced()), this, SLOT(handlePointsReplaced()));
     QObject::connect(series, SIGNAL(pointAdded(int)), this, SLOT(handlePointAdded(int)));
+    QObject::connect(series, SIGNAL(pointsAdded(int, int)), this, SLOT(handlePointsAdded(int, int)));
     QObject::connect(series, SIGNAL(pointRemoved(int)), this, SLOT(handlePointRemoved(int)));
     QObject::connect(series, SIGNAL(pointsRemoved(int, int)), this, SLOT(handlePointsRemoved(int, int)));
+    QObject::connect(series->d_func(), SIGNAL(pointsEvicted(int, int, int)),
+                     this, SLOT(handlePointsEvicted(int, int, int)));
     QObject::connect(this, SIGNAL(clicked(QPointF)), series, SIGNAL(clicked(QPointF)));
     QObject::connect(this, SIGNAL(hovered(QPointF,bool)), series, SIGNAL(hovered(QPointF,bool)));
     QObject::connect(this, SIGNAL(pressed(QPointF)), series, SIGNAL(pressed(QPointF)));
@@ -65,6 +75,7 @@ XYChart::XYChart(QXYSeries *series, QGraphicsItem *item):
 void XYChart::setGeometryPoints(const QList<QPointF> &points)
 {
     m_points = points;
+    m_pointGrid.geometryChanged(++m_geometryRevision);
 }
 
 void XYChart::setAnimation(XYAnimation *animation)
@@ -94,7 +105,7 @@ QList<bool> XYChart::offGridStatusVector()
     const int seriesLastIndex = m_series->count() - 1;
 
     for (int i = 0; i < m_points.size(); i++) {
-        const QPointF &seriesPoint = m_series->at(qMin(seriesLastIndex, i));
+        const QPointF &seriesPoint = m_series->at(qMin(seriesLastIndex, m_geometryOffset + i));
         if (seriesPoint.x() < minX
             || seriesPoint.x() > maxX
             || seriesPoint.y() < minY
@@ -110,14 +121,15 @@ QList<bool> XYChart::offGridStatusVector()
 void XYChart::updateChart(const QList<QPointF> &oldPoints, const QList<QPointF> &newPoints,
                           int index)
 {
-
     if (m_animation) {
         m_animation->setup(oldPoints, newPoints, index);
         m_points = newPoints;
+        m_pointGrid.geometryChanged(++m_geometryRevision);
         setDirty(false);
         presenter()->startAnimation(m_animation);
     } else {
         m_points = newPoints;
+        m_pointGrid.geometryChanged(++m_geometryRevision);
         updateGeometry();
     }
 }
@@ -143,21 +155,76 @@ void XYChart::handlePointAdded(int index)
     Q_ASSERT(index < m_series->count());
     Q_ASSERT(index >= 0);
 
+    // Evicting the oldest points is handled together with the points added after it
+    if (m_series->d_func()->isEvicting())
+        return;
+
     if (m_series->useOpenGL()) {
-        updateGlChart();
+        dataSet()->glXYSeriesDataManager()->insertPoints(m_series, domain(), index, 1);
+        presenter()->updateGLWidget();
+        updateGeometry();
     } else {
+        if (coalesceUpdate(index, 1, true))
+            return;
+        if (deferGeometryUpdate())
+            return;
         QList<QPointF> points;
-        if (m_dirty || m_points.isEmpty()) {
-            points = domain()->calculateGeometryPoints(m_series->points());
+        int offset = 0;
+        if (m_dirty || m_points.isEmpty() || !isGeometryComplete(1)) {
+            points = calculateSeriesGeometryPoints(offset);
         } else {
             points = m_points;
             QPointF point =
-                    domain()->calculateGeometryPoint(m_series->points().at(index), m_validData);
-            if (!m_validData)
+                    domain()->calculateGeometryPoint(m_series->d_func()->seriesPoint(index),
+                                                     m_validData);
+            if (!m_validData) {
                 m_points.clear();
-            else
+            } else {
                 points.insert(index, point);
+                m_pointGrid.pointsInserted(m_geometryRevision, points, index, 1);
+            }
+        }
+        m_geometryOffset = offset;
+        updateChart(m_points, points, index);
+    }
+}
+
+void XYChart::handlePointsAdded(int index, int count)
+{
+    Q_ASSERT(index + count <= m_series->count());
+    Q_ASSERT(index >= 0);
+
+    if (m_series->d_func()->isEvicting())
+        return;
+
+    if (m_series->useOpenGL()) {
+        dataSet()->glXYSeriesDataManager()->insertPoints(m_series, domain(), index, count);
+        presenter()->updateGLWidget();
+        updateGeometry();
+    } else {
+        if (coalesceUpdate(index, count, true))
+            return;
+        if (deferGeometryUpdate())
+            return;
+        QList<QPointF> points;
+        int offset = 0;
+        if (m_dirty || m_points.isEmpty() || !isGeometryComplete(count)) {
+            points = calculateSeriesGeometryPoints(offset);
+        } else {
+            // Only the added block needs to be transformed, the rest of the geometry is reused
+            const QList<QPointF> addedPoints = domain()->calculateGeometryPoints(
+                    m_series->d_func()->seriesPoints(index, count));
+            if (addedPoints.count() != count) {
+                // Invalid data in the block (e.g. non-positive values on a log axis)
+                points = calculateSeriesGeometryPoints(offset);
+            } else {
+                points = m_points;
+                points.insert(index, count, QPointF());
+                std::copy(addedPoints.cbegin(), addedPoints.cend(), points.begin() + index);
+                m_pointGrid.pointsInserted(m_geometryRevision, points, index, count);
+            }
         }
+        m_geometryOffset = offset;
         updateChart(m_points, points, index);
     }
 }
@@ -167,16 +234,28 @@ void XYChart::handlePointRemoved(int index)
     Q_ASSERT(index <= m_series->count());
     Q_ASSERT(index >= 0);
 
+    if (m_series->d_func()->isEvicting())
+        return;
+
     if (m_series->useOpenGL()) {
-        updateGlChart();
+        dataSet()->glXYSeriesDataManager()->removePoints(m_series, domain(), index, 1);
+        presenter()->updateGLWidget();
+        updateGeometry();
     } else {
+        if (coalesceUpdate(index, 1, true))
+            return;
+        if (deferGeometryUpdate())
+            return;
         QList<QPointF> points;
-        if (m_dirty || m_points.isEmpty()) {
-            points = domain()->calculateGeometryPoints(m_series->points());
+        int offset = 0;
+        if (m_dirty || m_points.isEmpty() || !isGeometryComplete(-1)) {
+            points = calculateSeriesGeometryPoints(offset);
         } else {
+            m_pointGrid.pointsRemoved(m_geometryRevision, m_points, index, 1);
             points = m_points;
             points.remove(index);
         }
+        m_geometryOffset = offset;
         updateChart(m_points, points, index);
     }
 }
@@ -186,40 +265,114 @@ void XYChart::handlePointsRemoved(int index, int count)
     Q_ASSERT(index <= m_series->count());
     Q_ASSERT(index >= 0);
 
+    if (m_series->d_func()->isEvicting())
+        return;
+
     if (m_series->useOpenGL()) {
-        updateGlChart();
+        dataSet()->glXYSeriesDataManager()->removePoints(m_series, domain(), index, count);
+        presenter()->updateGLWidget();
+        updateGeometry();
     } else {
+        if (coalesceUpdate(index, count, true))
+            return;
+        if (deferGeometryUpdate())
+            return;
         QList<QPointF> points;
-        if (m_dirty || m_points.isEmpty()) {
-            points = domain()->calculateGeometryPoints(m_series->points());
+        int offset = 0;
+        if (m_dirty || m_points.isEmpty() || !isGeometryComplete(-count)) {
+            points = calculateSeriesGeometryPoints(offset);
         } else {
+            m_pointGrid.pointsRemoved(m_geometryRevision, m_points, index, count);
             points = m_points;
             points.remove(index, count);
         }
+        m_geometryOffset = offset;
         updateChart(m_points, points, index);
     }
 }
 
+// The oldest points were evicted from the front of the series to make room for the points
+// added at index. The geometry of the evicted points is dropped and only the added points
+// are transformed.
+void XYChart::handlePointsEvicted(int evicted, int index, int count)
+{
+    if (m_series->useOpenGL()) {
+        dataSet()->glXYSeriesDataManager()->evictPoints(m_series, domain(), evicted, index,
+                                                        count);
+        presenter()->updateGLWidget();
+        updateGeometry();
+        return;
+    }
+
+    if (coalesceUpdate(0, index + count, true))
+        return;
+    if (deferGeometryUpdate())
+        return;
+
+    QList<QPointF> points;
+    QList<QPointF> addedPoints;
+    int offset = 0;
+    const bool reuse = !m_dirty && !m_points.isEmpty() && isGeometryComplete(count - evicted);
+    if (reuse) {
+        addedPoints = domain()->calculateGeometryPoints(
+                m_series->d_func()->seriesPoints(index, count));
+    }
+    if (!reuse || addedPoints.count() != count) {
+        points = calculateSeriesGeometryPoints(offset);
+    } else {
+        m_pointGrid.pointsRemoved(m_geometryRevision, m_points, 0, evicted);
+        if (m_animation) {
+            points = m_points;
+        } else {
+            // Nothing else needs the old geometry, so the remaining points are kept in place
+            // instead of being copied. Removing from the front of a list doesn't move them.
+            points = std::move(m_points);
+            m_points = QList<QPointF>();
+        }
+        points.remove(0, evicted);
+        if (index == points.count()) {
+            points.append(addedPoints);
+        } else {
+            points.insert(index, count, QPointF());
+            std::copy(addedPoints.cbegin(), addedPoints.cend(), points.begin() + index);
+        }
+        m_pointGrid.pointsInserted(m_geometryRevision, points, index, count);
+    }
+    m_geometryOffset = offset;
+    updateChart(m_points, points, 0);
+}
+
 void XYChart::handlePointReplaced(int index)
 {
     Q_ASSERT(index < m_series->count());
     Q_ASSERT(index >= 0);
 
     if (m_series->useOpenGL()) {
-        updateGlChart();
+        dataSet()->glXYSeriesDataManager()->replacePoints(m_series, domain(), index, 1);
+        presenter()->updateGLWidget();
+        updateGeometry();
     } else {
+        if (coalesceUpdate(index, 1, false))
+            return;
+        if (deferGeometryUpdate())
+            return;
         QList<QPointF> points;
-        if (m_dirty || m_points.isEmpty()) {
-            points = domain()->calculateGeometryPoints(m_series->points());
+        int offset = 0;
+        if (m_dirty || m_points.isEmpty() || !isGeometryComplete(0)) {
+            points = calculateSeriesGeometryPoints(offset);
         } else {
             QPointF point =
-                    domain()->calculateGeometryPoint(m_series->points().at(index), m_validData);
+                    domain()->calculateGeometryPoint(m_series->d_func()->seriesPoint(index),
+                                                     m_validData);
             if (!m_validData)
                 m_points.clear();
             points = m_points;
-            if (m_validData)
+            if (m_validData) {
                 points.replace(index, point);
+                m_pointGrid.pointsReplaced(m_geometryRevision, m_points, points, index, 1);
+            }
         }
+        m_geometryOffset = offset;
         updateChart(m_points, points, index);
     }
 }
@@ -229,8 +382,14 @@ void XYChart::handlePointsReplaced()
     if (m_series->useOpenGL()) {
         updateGlChart();
     } else {
+        if (coalesceUpdate(0, m_series->count(), true))
+            return;
+        if (deferGeometryUpdate())
+            return;
         // All the points were replaced -> recalculate
-        QList<QPointF> points = domain()->calculateGeometryPoints(m_series->points());
+        int offset = 0;
+        QList<QPointF> points = calculateSeriesGeometryPoints(offset);
+        m_geometryOffset = offset;
         updateChart(m_points, points, -1);
     }
 }
@@ -238,17 +397,149 @@ void XYChart::handlePointsReplaced()
 void XYChart::handleDomainUpdated()
 {
     if (m_series->useOpenGL()) {
-        updateGlChart();
+        dataSet()->glXYSeriesDataManager()->setDomain(m_series, domain());
+        presenter()->updateGLWidget();
+        updateGeometry();
     } else {
         if (isEmpty()) return;
-        QList<QPointF> points = domain()->calculateGeometryPoints(m_series->points());
+        if (deferGeometryUpdate())
+            return;
+        int offset = 0;
+        QList<QPointF> points = calculateSeriesGeometryPoints(offset);
+        m_geometryOffset = offset;
         updateChart(m_points, points);
     }
 }
 
+// When the presenter coalesces the changes of the series, the changed index range is only
+// recorded here, and handleCoalescedUpdate() is called once per frame. Changes that add or
+// remove points are structural, and make the whole geometry to be recalculated.
+bool XYChart::coalesceUpdate(int index, int count, bool structural)
+{
+    if (!presenter() || !presenter()->coalesceSeriesUpdates())
+        return false;
+    if (structural) {
+        m_coalescedFullUpdate = true;
+        m_coalescedRanges.clear();
+    } else if (!m_coalescedFullUpdate) {
+        m_coalescedRanges.append(qMakePair(index, index + count));
+    }
+    if (!m_coalescedUpdatePending) {
+        m_coalescedUpdatePending = true;
+        presenter()->scheduleCoalescedUpdate(this);
+    }
+    return true;
+}
+
+void XYChart::handleCoalescedUpdate()
+{
+    const bool fullUpdate = m_coalescedFullUpdate;
+    QList<QPair<int, int>> ranges = m_coalescedRanges;
+    m_coalescedUpdatePending = false;
+    m_coalescedFullUpdate = false;
+    m_coalescedRanges.clear();
+
+    if (m_series->useOpenGL()) {
+        updateGlChart();
+        return;
+    }
+    if (deferGeometryUpdate())
+        return;
+
+    QList<QPointF> points;
+    int offset = 0;
+    if (fullUpdate || m_dirty || !isGeometryComplete(0)
+            || !updateGeometryRanges(points, ranges)) {
+        points = calculateSeriesGeometryPoints(offset);
+    }
+    m_geometryOffset = offset;
+    updateChart(m_points, points);
+}
+
+// Transforms only the points in the given index ranges, and takes the geometry of the
+// other points from the current geometry. Overlapping ranges are merged first, so every
+// point is transformed once. Returns false if a range contains invalid data.
+bool XYChart::updateGeometryRanges(QList<QPointF> &points, QList<QPair<int, int>> &ranges) const
+{
+    std::sort(ranges.begin(), ranges.end());
+    QList<QPair<int, int>> merged;
+    for (const QPair<int, int> &range : qAsConst(ranges)) {
+        if (!merged.isEmpty() && range.first <= merged.last().second)
+            merged.last().second = qMax(merged.last().second, range.second);
+        else
+            merged.append(range);
+    }
+
+    points = m_points;
+    for (const QPair<int, int> &range : qAsConst(merged)) {
+        const int count = range.second - range.first;
+        const QList<QPointF> transformed = domain()->calculateGeometryPoints(
+                m_series->d_func()->seriesPoints(range.first, count));
+        if (transformed.count() != count)
+            return false;
+        std::copy(transformed.cbegin(), transformed.cend(), points.begin() + range.first);
+    }
+    for (const QPair<int, int> &range : qAsConst(merged)) {
+        m_pointGrid.pointsReplaced(m_geometryRevision, m_points, points, range.first,
+                                   range.second - range.first);
+    }
+    return true;
+}
+
+// While zooming or scrolling, and when the chart calculates geometry asynchronously, the
+// geometry is calculated later by the geometry batch, together with the other series.
+bool XYChart::deferGeometryUpdate()
+{
+    return dataSet() && dataSet()->geometryBatch()->defer(this);
+}
+
+// Returns true if the geometry covers all the points of the series, which has got the given
+// number of points added since the geometry was calculated. Only such a geometry can be
+// updated in place, as its indexes match the indexes of the series.
+bool XYChart::isGeometryComplete(int added) const
+{
+    return m_geometryOffset == 0 && m_points.count() + added == m_series->count();
+}
+
+// For series with x values in ascending order only the visible points need to be
+// transformed. Splines are excluded as their shape depends on all the points, and so are
+// unclipped point labels, which would otherwise not be drawn outside of the plot area.
+// Animated series keep all the points, so that the animation can match them.
+bool XYChart::transformsVisiblePointsOnly() const
+{
+    if (!m_series->d_func()->isXSorted() || m_series->type() == QAbstractSeries::SeriesTypeSpline
+            || m_animation) {
+        return false;
+    }
+
+    const bool labelsDrawn = m_series->pointLabelsVisible()
+            || !m_series->pointsConfiguration().isEmpty();
+    return !labelsDrawn || m_series->pointLabelsClipping();
+}
+
+// The geometry may only cover the visible part of the series, offset is set to the index of
+// the series point that the first geometry point belongs to.
+QList<QPointF> XYChart::calculateSeriesGeometryPoints(int &offset) const
+{
+    offset = 0;
+    // Adopted columns are transformed straight from the x and y arrays
+    if (const XYColumns *columns = m_series->d_func()->columns()) {
+        if (transformsVisiblePointsOnly()) {
+            return domain()->calculateVisibleGeometryPoints(columns->x(), columns->y(),
+                                                            columns->count(), offset);
+        }
+        return domain()->calculateGeometryPoints(columns->x(), columns->y(), columns->count());
+    }
+
+    const QList<QPointF> &points = m_series->points();
+    if (transformsVisiblePointsOnly())
+        return domain()->calculateVisibleGeometryPoints(points, offset);
+    return domain()->calculateGeometryPoints(points);
+}
+
 bool XYChart::isEmpty()
 {
-    return domain()->isEmpty() || m_series->points().isEmpty();
+    return domain()->isEmpty() || m_series->count() == 0;
 }
 
 QPointF XYChart::matchForLightMarker(const QPointF &eventPos)
@@ -259,18 +550,31 @@ QPointF XYChart::matchForLightMarker(const QPointF &eventPos)
     int markerWidth =  m_series->lightMarker().width();
     int markerHeight =  m_series->lightMarker().height();
 
-    for (const QPointF &dp : m_series->points()) {
+    // '+2' and '+4': There is an addRect for the (mouse-)shape
+    // in LineChartItem::updateGeometry()
+    // This has a margin of 1 to make sure a press in the icon will always be detected,
+    // but as there is a bunch of 'translations' and therefore inaccuracies,
+    // so it is necessary to increase that margin to 2
+    // (otherwise you can click next to an icon, get a click event but not match it)
+    const qreal halfWidth = markerWidth / 2 + 2;
+    const qreal halfHeight = markerHeight / 2 + 2;
+    const QRectF area(eventPos.x() - halfWidth, eventPos.y() - halfHeight,
+                      markerWidth + 4, markerHeight + 4);
+
+    // The geometry points only nominate the candidates, which are then checked against
+    // the series, so the first matching point of the series is returned as before
+    QList<int> candidates = geometryPointsIn(area, lightMarkerCellSize());
+    std::sort(candidates.begin(), candidates.end());
+    const int seriesCount = m_series->count();
+    for (int i : qAsConst(candidates)) {
+        const int index = m_geometryOffset + i;
+        if (index >= seriesCount)
+            break;
+        const QPointF &dp = m_series->at(index);
         bool ok;
         const QPointF gp = domain()->calculateGeometryPoint(dp, ok);
         if (ok) {
-            // '+2' and '+4': There is an addRect for the (mouse-)shape
-            // in LineChartItem::updateGeometry()
-            // This has a margin of 1 to make sure a press in the icon will always be detected,
-            // but as there is a bunch of 'translations' and therefore inaccuracies,
-            // so it is necessary to increase that margin to 2
-            // (otherwise you can click next to an icon, get a click event but not match it)
-            QRectF r(gp.x() - (markerWidth / 2 + 2),
-                     gp.y() - (markerHeight / 2 + 2),
+            QRectF r(gp.x() - halfWidth, gp.y() - halfHeight,
                      markerWidth + 4, markerHeight + 4);
 
             if (r.contains(eventPos))
@@ -280,6 +584,21 @@ QPointF XYChart::matchForLightMarker(const QPointF &eventPos)
     return QPointF(qQNaN(), qQNaN()); // 0,0 could actually be in points()
 }
 
+// Returns the indexes of the geometry points within the rect, using a grid whose cells
+// are about the size of the markers. The geometry offset is not added to them.
+QList<int> XYChart::geometryPointsIn(const QRectF &rect, qreal cellSize) const
+{
+    return m_pointGrid.pointsIn(m_points, m_geometryRevision, rect, cellSize);
+}
+
+// The grid is rebuilt whenever it is queried with another cell size, so all the queries for
+// the light marker must use this one
+qreal XYChart::lightMarkerCellSize() const
+{
+    const QImage &marker = m_series->lightMarker();
+    return qMax(marker.width(), marker.height()) + 4;
+}
+
 QT_END_NAMESPACE
 
 #include "moc_xychart_p.cpp"
@@ -41,6 +41,7 @@
 
 #include <QtCharts/QChartGlobal>
 #include <private/chartitem_p.h>
+#include <private/xypointgrid_p.h>
 #include <private/xyanimation_p.h>
 #include <QtCharts/QValueAxis>
 #include <QtCharts/QXYSeries>
@@ -60,6 +61,8 @@ public:
 
     void setGeometryPoints(const QList<QPointF> &points);
     QList<QPointF> geometryPoints() const { return m_points; }
+    int geometryOffset() const { return m_geometryOffset; }
+    quint64 geometryRevision() const { return m_geometryRevision; }
 
     void setAnimation(XYAnimation *animation);
     ChartAnimation *animation() const override { return m_animation; }
@@ -73,11 +76,14 @@ public:
 
 public Q_SLOTS:
     void handlePointAdded(int index);
+    void handlePointsAdded(int index, int count);
     void handlePointRemoved(int index);
     void handlePointsRemoved(int index, int count);
+    void handlePointsEvicted(int evicted, int index, int count);
     void handlePointReplaced(int index);
     void handlePointsReplaced();
     void handleDomainUpdated() override;
+    void handleCoalescedUpdate();
 
 Q_SIGNALS:
     void clicked(const QPointF &point);
@@ -93,22 +99,40 @@ protected:
     virtual void refreshGlChart();
 
     QPointF matchForLightMarker(const QPointF &eventPos);
+    QList<int> geometryPointsIn(const QRectF &rect, qreal cellSize) const;
+    qreal lightMarkerCellSize() const;
 
 private:
     inline bool isEmpty();
+    bool coalesceUpdate(int index, int count, bool structural);
+    bool updateGeometryRanges(QList<QPointF> &points, QList<QPair<int, int>> &ranges) const;
+    bool deferGeometryUpdate();
+    bool isGeometryComplete(int added) const;
+    bool transformsVisiblePointsOnly() const;
+    QList<QPointF> calculateSeriesGeometryPoints(int &offset) const;
 
 protected:
     QXYSeries *m_series;
     QList<QPointF> m_points;
+    // The index of the series point that the first geometry point belongs to
+    int m_geometryOffset;
     QList<int> m_selectedPoints;
     QColor m_selectedColor;
     XYAnimation *m_animation;
     bool m_dirty;
+    // Increased whenever the geometry points change
+    quint64 m_geometryRevision;
+    mutable XYPointGrid m_pointGrid;
 
     QHash<int, QHash<QXYSeries::PointConfiguration, QVariant>> m_pointsConfiguration;
     bool m_pointsConfigurationDirty;
 
+    bool m_coalescedUpdatePending;
+    bool m_coalescedFullUpdate;
+    QList<QPair<int, int>> m_coalescedRanges;
+
     friend class AreaChartItem;
+    friend class XYGeometryBatch;
 };
 
 QT_END_NAMESPACE
@@ -0,0 +1,175 @@
+/****************************************************************************
+**
+** Copyright (C) 2021 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <private/xyclipper_p.h>
+#include <QtCore/QtMath>
+
+QT_BEGIN_NAMESPACE
+
+namespace {
+
+// Liang-Barsky: narrows [t0, t1] of the segment p + t * delta to the part inside the rect.
+bool clipSegment(const QPointF &p, const QPointF &delta, const QRectF &rect,
+                 qreal &t0, qreal &t1)
+{
+    const qreal q[4] = { p.x() - rect.left(), rect.right() - p.x(),
+                         p.y() - rect.top(), rect.bottom() - p.y() };
+    const qreal d[4] = { -delta.x(), delta.x(), -delta.y(), delta.y() };
+    t0 = 0.0;
+    t1 = 1.0;
+    for (int i = 0; i < 4; ++i) {
+        if (d[i] == 0.0) {
+            if (q[i] < 0.0)
+                return false;
+            continue;
+        }
+        const qreal t = q[i] / d[i];
+        if (d[i] < 0.0) {
+            if (t > t1)
+                return false;
+            if (t > t0)
+                t0 = t;
+        } else {
+            if (t < t0)
+                return false;
+            if (t < t1)
+                t1 = t;
+        }
+    }
+    return true;
+}
+
+bool isFinite(const QPointF &point)
+{
+    return qIsFinite(point.x()) && qIsFinite(point.y());
+}
+
+enum Edge { Left, Right, Top, Bottom };
+
+bool inside(const QPointF &point, Edge edge, const QRectF &rect)
+{
+    switch (edge) {
+    case Left:
+        return point.x() >= rect.left();
+    case Right:
+        return point.x() <= rect.right();
+    case Top:
+        return point.y() >= rect.top();
+    case Bottom:
+        return point.y() <= rect.bottom();
+    }
+    return false;
+}
+
+QPointF intersection(const QPointF &a, const QPointF &b, Edge edge, const QRectF &rect)
+{
+    if (edge == Left || edge == Right) {
+        const qreal x = edge == Left ? rect.left() : rect.right();
+        return QPointF(x, a.y() + (b.y() - a.y()) * (x - a.x()) / (b.x() - a.x()));
+    }
+    const qreal y = edge == Top ? rect.top() : rect.bottom();
+    return QPointF(a.x() + (b.x() - a.x()) * (y - a.y()) / (b.y() - a.y()), y);
+}
+
+}
+
+// Splits the polyline into the polylines that are inside the rect. The parts that leave
+// the rect are cut at the edges of the rect. A polyline that is fully inside the rect is
+// returned as it is, without copying the points.
+QList<QPolygonF> XYClipper::clipPolyline(const QList<QPointF> &points, const QRectF &rect)
+{
+    QList<QPolygonF> polylines;
+    if (points.isEmpty())
+        return polylines;
+
+    if (rect.contains(QPolygonF(points).boundingRect())) {
+        polylines.append(points);
+        return polylines;
+    }
+
+    QPolygonF current;
+    for (int i = 1; i < points.size(); ++i) {
+        const QPointF &p1 = points.at(i - 1);
+        const QPointF &p2 = points.at(i);
+        const QPointF delta = p2 - p1;
+        qreal t0;
+        qreal t1;
+        if (!isFinite(p1) || !isFinite(p2) || !clipSegment(p1, delta, rect, t0, t1)) {
+            if (current.size() > 1)
+                polylines.append(current);
+            current.clear();
+            continue;
+        }
+        // A segment entering the rect starts a new polyline
+        if (t0 > 0.0 || current.isEmpty()) {
+            if (current.size() > 1)
+                polylines.append(current);
+            current.clear();
+            current.append(t0 > 0.0 ? p1 + t0 * delta : p1);
+        }
+        current.append(t1 < 1.0 ? p1 + t1 * delta : p2);
+        // A segment leaving the rect ends it
+        if (t1 < 1.0) {
+            polylines.append(current);
+            current.clear();
+        }
+    }
+    if (current.size() > 1)
+        polylines.append(current);
+    return polylines;
+}
+
+// Sutherland-Hodgman: clips the polygon to each edge of the rect in turn. Parts of the
+// polygon outside of the rect are replaced by runs along the edges of the rect, which
+// the pen margin of the rect keeps out of sight.
+QPolygonF XYClipper::clipPolygon(const QPolygonF &polygon, const QRectF &rect)
+{
+    if (polygon.isEmpty() || rect.contains(polygon.boundingRect()))
+        return polygon;
+
+    QPolygonF result = polygon;
+    for (Edge edge : { Left, Right, Top, Bottom }) {
+        if (result.isEmpty())
+            break;
+        const QPolygonF input = result;
+        result.clear();
+        QPointF previous = input.last();
+        for (const QPointF &point : input) {
+            const bool pointInside = inside(point, edge, rect);
+            if (pointInside != inside(previous, edge, rect))
+                result.append(intersection(previous, point, edge, rect));
+            if (pointInside)
+                result.append(point);
+            previous = point;
+        }
+    }
+    return result;
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,83 @@
+/****************************************************************************
+**
+** Copyright (C) 2021 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <private/xycolumns_p.h>
+#include <private/domaintransforms_p.h>
+
+QT_BEGIN_NAMESPACE
+
+XYColumns::XYColumns(const qreal *x, const qreal *y, qsizetype count,
+                     std::function<void()> release)
+    : m_x(x),
+      m_y(y),
+      m_count(count),
+      m_release(std::move(release))
+{
+}
+
+XYColumns::~XYColumns()
+{
+    if (m_release)
+        m_release();
+}
+
+QList<QPointF> XYColumns::mid(qsizetype index, qsizetype count) const
+{
+    count = qBound(qsizetype(0), count, m_count - index);
+    QList<QPointF> points(count);
+    DomainTransforms::interleave(points.data(), m_x + index, m_y + index, count);
+    return points;
+}
+
+bool XYColumns::isXSorted() const
+{
+    for (qsizetype i = 1; i < m_count; ++i) {
+        if (m_x[i] < m_x[i - 1])
+            return false;
+    }
+    return true;
+}
+
+bool XYColumns::bounds(qreal &minX, qreal &maxX, qreal &minY, qreal &maxY) const
+{
+    if (m_count == 0)
+        return false;
+
+    minX = maxX = m_x[0];
+    minY = maxY = m_y[0];
+    for (qsizetype i = 1; i < m_count; ++i) {
+        minX = qMin(minX, m_x[i]);
+        maxX = qMax(maxX, m_x[i]);
+        minY = qMin(minY, m_y[i]);
+        maxY = qMax(maxY, m_y[i]);
+    }
+    return true;
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,78 @@
+/****************************************************************************
+**
+** Copyright (C) 2021 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt Chart API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+
+#ifndef XYCOLUMNS_P_H
+#define XYCOLUMNS_P_H
+
+#include <QtCharts/private/qchartglobal_p.h>
+#include <QtCore/QList>
+#include <QtCore/QPointF>
+#include <functional>
+
+QT_BEGIN_NAMESPACE
+
+// Separate x and y arrays adopted by a series without copying them. The arrays stay owned
+// by the application, which is told through the release function when the series no
+// longer uses them.
+class Q_CHARTS_PRIVATE_EXPORT XYColumns
+{
+public:
+    XYColumns(const qreal *x, const qreal *y, qsizetype count, std::function<void()> release);
+    ~XYColumns();
+
+    const qreal *x() const { return m_x; }
+    const qreal *y() const { return m_y; }
+    qsizetype count() const { return m_count; }
+    QPointF at(qsizetype index) const { return QPointF(m_x[index], m_y[index]); }
+
+    QList<QPointF> mid(qsizetype index, qsizetype count) const;
+    bool isXSorted() const;
+    bool bounds(qreal &minX, qreal &maxX, qreal &minY, qreal &maxY) const;
+
+private:
+    Q_DISABLE_COPY(XYColumns)
+
+    const qreal *m_x;
+    const qreal *m_y;
+    qsizetype m_count;
+    std::function<void()> m_release;
+};
+
+QT_END_NAMESPACE
+
+#endif // XYCOLUMNS_P_H
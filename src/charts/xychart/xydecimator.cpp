@@ -0,0 +1,161 @@
+/****************************************************************************
+**
+** Copyright (C) 2021 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <private/xydecimator_p.h>
+#include <private/xyclipper_p.h>
+#include <QtCore/QtMath>
+
+QT_BEGIN_NAMESPACE
+
+QList<QPointF> XYDecimator::decimate(const QList<QPointF> &points,
+                                     QXYSeries::DecimationMode mode, qreal plotWidth)
+{
+    // Decimation only pays off when there are clearly more points than pixel columns
+    const int columns = qMax(1, qCeil(plotWidth));
+    if (points.count() <= 2 * columns)
+        return points;
+
+    switch (mode) {
+    case QXYSeries::DecimationMode::MinMax:
+        return minMax(points);
+    case QXYSeries::DecimationMode::LargestTriangleThreeBuckets:
+        return largestTriangleThreeBuckets(points, 2 * columns);
+    case QXYSeries::DecimationMode::NoDecimation:
+    default:
+        return points;
+    }
+}
+
+// Clips the line to the rect first, and then decimates each of the resulting polylines for
+// the width that it covers. When zoomed in, the points outside of the rect don't take away
+// from the columns of the visible part.
+QList<QPolygonF> XYDecimator::decimateClipped(const QList<QPointF> &points,
+                                              QXYSeries::DecimationMode mode,
+                                              const QRectF &clipRect)
+{
+    QList<QPolygonF> polylines = XYClipper::clipPolyline(points, clipRect);
+    if (mode == QXYSeries::DecimationMode::NoDecimation)
+        return polylines;
+
+    for (QPolygonF &polyline : polylines)
+        polyline = QPolygonF(decimate(polyline, mode, polyline.boundingRect().width()));
+    return polylines;
+}
+
+// Collapses each run of consecutive points that falls into the same pixel column into the
+// first, minimum, maximum and last point of the run, in their original order. This keeps
+// the vertical extent of every column as well as the connections between the columns, so
+// the drawn line covers exactly the same pixels as the full data.
+QList<QPointF> XYDecimator::minMax(const QList<QPointF> &points)
+{
+    QList<QPointF> result;
+    const int count = points.count();
+    if (count == 0)
+        return result;
+
+    int i = 0;
+    while (i < count) {
+        const qreal column = qFloor(points.at(i).x());
+        int minIndex = i;
+        int maxIndex = i;
+        int j = i + 1;
+        while (j < count && qFloor(points.at(j).x()) == column) {
+            if (points.at(j).y() < points.at(minIndex).y())
+                minIndex = j;
+            if (points.at(j).y() > points.at(maxIndex).y())
+                maxIndex = j;
+            ++j;
+        }
+
+        const int indexes[4] = { i, qMin(minIndex, maxIndex), qMax(minIndex, maxIndex), j - 1 };
+        int previous = -1;
+        for (int index : indexes) {
+            if (index != previous) {
+                result.append(points.at(index));
+                previous = index;
+            }
+        }
+        i = j;
+    }
+    return result;
+}
+
+// Largest-Triangle-Three-Buckets by Sveinn Steinarsson. Keeps the first and last points
+// and from each bucket in between the point that forms the largest triangle with the point
+// kept from the previous bucket and the average of the next bucket.
+QList<QPointF> XYDecimator::largestTriangleThreeBuckets(const QList<QPointF> &points,
+                                                        int threshold)
+{
+    const int count = points.count();
+    if (threshold < 3 || threshold >= count)
+        return points;
+
+    QList<QPointF> result;
+    result.reserve(threshold);
+    result.append(points.first());
+
+    const qreal bucketSize = qreal(count - 2) / (threshold - 2);
+    int a = 0;
+
+    for (int i = 0; i < threshold - 2; ++i) {
+        const int averageStart = qFloor((i + 1) * bucketSize) + 1;
+        const int averageEnd = qMin(qFloor((i + 2) * bucketSize) + 1, count);
+        qreal averageX = 0;
+        qreal averageY = 0;
+        for (int j = averageStart; j < averageEnd; ++j) {
+            averageX += points.at(j).x();
+            averageY += points.at(j).y();
+        }
+        const int averageLength = averageEnd - averageStart;
+        averageX /= averageLength;
+        averageY /= averageLength;
+
+        const int rangeStart = qFloor(i * bucketSize) + 1;
+        const int rangeEnd = qFloor((i + 1) * bucketSize) + 1;
+        const QPointF &pointA = points.at(a);
+        qreal maxArea = -1;
+        int next = rangeStart;
+        for (int j = rangeStart; j < rangeEnd; ++j) {
+            const qreal area = qAbs((pointA.x() - averageX) * (points.at(j).y() - pointA.y())
+                                    - (pointA.x() - points.at(j).x()) * (averageY - pointA.y()));
+            if (area > maxArea) {
+                maxArea = area;
+                next = j;
+            }
+        }
+
+        result.append(points.at(next));
+        a = next;
+    }
+
+    result.append(points.last());
+    return result;
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,70 @@
+/****************************************************************************
+**
+** Copyright (C) 2021 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt Chart API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+
+#ifndef XYDECIMATOR_P_H
+#define XYDECIMATOR_P_H
+
+#include <QtCharts/QXYSeries>
+#include <QtCharts/private/qchartglobal_p.h>
+#include <QtCore/QList>
+#include <QtCore/QPointF>
+#include <QtCore/QRectF>
+#include <QtGui/QPolygonF>
+
+QT_BEGIN_NAMESPACE
+
+// Reduces geometry points to what can actually be seen on a plot of a given width.
+// All functions work on geometry (pixel) coordinates.
+class Q_CHARTS_PRIVATE_EXPORT XYDecimator
+{
+public:
+    static QList<QPointF> decimate(const QList<QPointF> &points,
+                                   QXYSeries::DecimationMode mode, qreal plotWidth);
+    static QList<QPolygonF> decimateClipped(const QList<QPointF> &points,
+                                            QXYSeries::DecimationMode mode,
+                                            const QRectF &clipRect);
+
+    static QList<QPointF> minMax(const QList<QPointF> &points);
+    static QList<QPointF> largestTriangleThreeBuckets(const QList<QPointF> &points,
+                                                      int threshold);
+};
+
+QT_END_NAMESPACE
+
+#endif // XYDECIMATOR_P_H
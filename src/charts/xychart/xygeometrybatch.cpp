@@ -0,0 +1,314 @@
+/****************************************************************************
+**
+** Copyright (C) 2021 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <private/xygeometrybatch_p.h>
+#include <private/xychart_p.h>
+#include <private/qxyseries_p.h>
+#include <private/abstractdomain_p.h>
+#include <private/chartdataset_p.h>
+#include <QtCore/QSemaphore>
+#include <QtCore/QThread>
+#include <QtCore/QThreadPool>
+#include <algorithm>
+
+QT_BEGIN_NAMESPACE
+
+struct XYGeometryBatch::Job
+{
+    QPointer<XYChart> chart;
+    const AbstractDomain *domain;
+    QList<QPointF> points; // The part of the series that is transformed
+    QList<QPointF> result;
+    QPointF *resultData;
+    int first;
+    int count;
+    QAtomicInt failed;
+};
+
+struct XYGeometryBatch::Chunk
+{
+    int job;
+    int begin;
+    int end;
+};
+
+struct XYGeometryBatch::Build
+{
+    int generation;
+    QList<Job> jobs;
+    QList<Chunk> chunks;
+    QList<AbstractDomain *> domainCopies;
+    QAtomicInt next;
+    QAtomicInt running;
+};
+
+XYGeometryBatch::XYGeometryBatch(ChartDataSet *dataSet)
+    : QObject(dataSet),
+      m_dataSet(dataSet),
+      m_threadCount(QThread::idealThreadCount()),
+      m_asynchronous(false),
+      m_buildScheduled(false),
+      m_depth(0),
+      m_pool(nullptr)
+{
+}
+
+XYGeometryBatch::~XYGeometryBatch()
+{
+    if (m_pool) {
+        // Cancel the builds in progress
+        m_generation.ref();
+        m_pool->waitForDone();
+    }
+}
+
+void XYGeometryBatch::setThreadCount(int count)
+{
+    m_threadCount = qMax(1, count);
+    if (m_pool)
+        m_pool->setMaxThreadCount(m_threadCount);
+}
+
+void XYGeometryBatch::setAsynchronous(bool asynchronous)
+{
+    if (m_asynchronous == asynchronous)
+        return;
+    m_asynchronous = asynchronous;
+    if (!asynchronous && (!m_building.isEmpty() || !m_charts.isEmpty())) {
+        // Finish the charts of the cancelled asynchronous build, and the ones waiting for
+        // the next build, right away
+        for (const QPointer<XYChart> &chart : qAsConst(m_building)) {
+            if (!m_charts.contains(chart))
+                m_charts.append(chart);
+        }
+        m_building.clear();
+        begin();
+        end();
+    }
+}
+
+void XYGeometryBatch::begin()
+{
+    ++m_depth;
+}
+
+// Returns true if the geometry of the chart is calculated later by the batch
+bool XYGeometryBatch::defer(XYChart *chart)
+{
+    if (m_depth == 0 && !m_asynchronous)
+        return false;
+    if (!m_charts.contains(chart))
+        m_charts.append(chart);
+    if (m_depth == 0)
+        scheduleBuild();
+    return true;
+}
+
+void XYGeometryBatch::end()
+{
+    Q_ASSERT(m_depth > 0);
+    if (--m_depth > 0 || m_charts.isEmpty())
+        return;
+
+    if (m_asynchronous) {
+        scheduleBuild();
+        return;
+    }
+
+    // Updates triggered while the charts are updated are not deferred anymore
+    const QList<QPointer<XYChart>> charts = m_charts;
+    m_charts.clear();
+    QSharedPointer<Build> build = createBuild(charts, false);
+
+    // The calling thread takes part in the work, so one thread less is started
+    const int helpers = qMin(m_threadCount, int(build->chunks.count())) - 1;
+    QSemaphore done;
+    for (int i = 0; i < helpers; ++i) {
+        pool()->start([this, &build, &done]() {
+            transform(build.data());
+            done.release();
+        });
+    }
+    transform(build.data());
+    done.acquire(qMax(0, helpers));
+    apply(build.data());
+}
+
+// Coalesces the updates of one event loop iteration into a single build
+void XYGeometryBatch::scheduleBuild()
+{
+    if (m_buildScheduled)
+        return;
+    m_buildScheduled = true;
+    QMetaObject::invokeMethod(this, &XYGeometryBatch::startBuild, Qt::QueuedConnection);
+}
+
+void XYGeometryBatch::startBuild()
+{
+    m_buildScheduled = false;
+    if (!m_asynchronous || m_depth > 0 || m_charts.isEmpty())
+        return;
+
+    // A new build cancels the one in progress, so it has to cover its charts as well
+    QList<QPointer<XYChart>> charts = m_building;
+    for (const QPointer<XYChart> &chart : qAsConst(m_charts)) {
+        if (!charts.contains(chart))
+            charts.append(chart);
+    }
+    charts.removeAll(nullptr);
+    m_charts.clear();
+    m_building = charts;
+
+    QSharedPointer<Build> build = createBuild(charts, true);
+    const int threads = qBound(1, int(build->chunks.count()), m_threadCount);
+    build->running.storeRelaxed(threads);
+    for (int i = 0; i < threads; ++i) {
+        pool()->start([this, build]() {
+            transform(build.data());
+            if (!build->running.deref()) {
+                QMetaObject::invokeMethod(this, [this, build]() { finishBuild(build); },
+                                          Qt::QueuedConnection);
+            }
+        });
+    }
+}
+
+QSharedPointer<XYGeometryBatch::Build> XYGeometryBatch::createBuild(
+        const QList<QPointer<XYChart>> &charts, bool copyDomains)
+{
+    QSharedPointer<Build> build(new Build);
+    build->generation = m_generation.fetchAndAddRelaxed(1) + 1;
+    build->jobs.reserve(charts.count());
+    for (const QPointer<XYChart> &chart : charts) {
+        if (chart.isNull())
+            continue;
+        const QXYSeriesPrivate *series =
+                static_cast<const QXYSeriesPrivate *>(chart->seriesPrivate());
+        const int pointCount = series->pointCount();
+        int first = 0;
+        int last = pointCount - 1;
+        if (chart->transformsVisiblePointsOnly()) {
+            if (const XYColumns *columns = series->columns())
+                chart->domain()->visibleIndexRange(columns->x(), columns->count(), first, last);
+            else
+                chart->domain()->visibleIndexRange(series->seriesPoints(), first, last);
+        }
+
+        Job job;
+        job.chart = chart;
+        job.domain = chart->domain();
+        if (copyDomains) {
+            AbstractDomain *copy = m_dataSet->copyDomain(chart->m_series);
+            if (!copy)
+                continue;
+            copy->setParent(this);
+            build->domainCopies.append(copy);
+            job.domain = copy;
+        }
+        job.points = series->seriesPoints(first, last - first + 1);
+        job.result = QList<QPointF>(job.points.count());
+        job.resultData = nullptr;
+        job.first = first;
+        job.count = pointCount;
+        const int count = job.points.count();
+        for (int begin = 0; begin < count; begin += ChunkSize) {
+            const Chunk chunk = { int(build->jobs.count()), begin, qMin(begin + ChunkSize, count) };
+            build->chunks.append(chunk);
+        }
+        build->jobs.append(job);
+    }
+
+    // Detach the results here, the workers only write to their own part of them
+    for (Job &job : build->jobs)
+        job.resultData = job.result.data();
+    return build;
+}
+
+// Can be called from any thread, the chunks are shared by all the threads working on the build
+void XYGeometryBatch::transform(Build *build) const
+{
+    Job *jobs = build->jobs.data();
+    const Chunk *chunks = build->chunks.constData();
+    const int chunkCount = build->chunks.count();
+    for (int i = build->next.fetchAndAddRelaxed(1); i < chunkCount;
+         i = build->next.fetchAndAddRelaxed(1)) {
+        // Stop as soon as a newer build has started
+        if (m_generation.loadRelaxed() != build->generation)
+            return;
+        const Chunk &chunk = chunks[i];
+        Job &job = jobs[chunk.job];
+        const int count = chunk.end - chunk.begin;
+        const QList<QPointF> transformed =
+                job.domain->calculateGeometryPoints(job.points.mid(chunk.begin, count));
+        if (transformed.count() != count)
+            job.failed.storeRelaxed(1);
+        else
+            std::copy(transformed.cbegin(), transformed.cend(), job.resultData + chunk.begin);
+    }
+}
+
+void XYGeometryBatch::finishBuild(const QSharedPointer<Build> &build)
+{
+    qDeleteAll(build->domainCopies);
+    build->domainCopies.clear();
+    // A newer build covers the charts of a cancelled one
+    if (build->generation != m_generation.loadRelaxed())
+        return;
+    m_building.clear();
+    apply(build.data());
+}
+
+// Hands the results to the charts in one go
+void XYGeometryBatch::apply(Build *build)
+{
+    for (Job &job : build->jobs) {
+        XYChart *chart = job.chart.data();
+        // Skip the charts that have changed since, they are part of the next build
+        if (!chart || m_charts.contains(chart) || chart->m_series->count() != job.count)
+            continue;
+        QList<QPointF> points;
+        if (!job.failed.loadRelaxed())
+            points = job.result;
+        chart->m_geometryOffset = points.isEmpty() ? 0 : job.first;
+        chart->updateChart(chart->m_points, points);
+    }
+}
+
+QThreadPool *XYGeometryBatch::pool()
+{
+    if (!m_pool) {
+        m_pool = new QThreadPool(this);
+        m_pool->setMaxThreadCount(m_threadCount);
+    }
+    return m_pool;
+}
+
+QT_END_NAMESPACE
+
+#include "moc_xygeometrybatch_p.cpp"
@@ -0,0 +1,111 @@
+/****************************************************************************
+**
+** Copyright (C) 2021 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt Chart API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+
+#ifndef XYGEOMETRYBATCH_P_H
+#define XYGEOMETRYBATCH_P_H
+
+#include <QtCharts/private/qchartglobal_p.h>
+#include <QtCore/QAtomicInt>
+#include <QtCore/QObject>
+#include <QtCore/QPointer>
+#include <QtCore/QSharedPointer>
+
+QT_BEGIN_NAMESPACE
+
+class QThreadPool;
+class AbstractDomain;
+class ChartDataSet;
+class XYChart;
+
+// Calculates the geometry of xy charts away from the charts' own update handlers.
+// Charts whose domain is updated between begin() and end() are collected, and their geometry
+// is calculated in end(). The series are split into chunks, which are transformed on a
+// thread pool, and the results are joined before they are handed to the charts.
+// In asynchronous mode every geometry update is deferred, and the transform runs entirely
+// on the thread pool against copies of the points and domains. The charts keep their old
+// geometry until the results of the newest build are applied to all of them at once; older
+// builds are cancelled. Only the domain transform is done here; the charts build their
+// drawing data from the applied geometry in their own updateGeometry().
+class Q_CHARTS_PRIVATE_EXPORT XYGeometryBatch : public QObject
+{
+    Q_OBJECT
+public:
+    explicit XYGeometryBatch(ChartDataSet *dataSet);
+    ~XYGeometryBatch();
+
+    void setThreadCount(int count);
+    int threadCount() const { return m_threadCount; }
+    void setAsynchronous(bool asynchronous);
+    bool isAsynchronous() const { return m_asynchronous; }
+
+    void begin();
+    bool defer(XYChart *chart);
+    void end();
+
+private Q_SLOTS:
+    void startBuild();
+
+private:
+    struct Job;
+    struct Chunk;
+    struct Build;
+
+    QSharedPointer<Build> createBuild(const QList<QPointer<XYChart>> &charts, bool copyDomains);
+    void transform(Build *build) const;
+    void finishBuild(const QSharedPointer<Build> &build);
+    void apply(Build *build);
+    void scheduleBuild();
+    QThreadPool *pool();
+
+    static const int ChunkSize = 16384;
+
+    ChartDataSet *m_dataSet;
+    int m_threadCount;
+    bool m_asynchronous;
+    bool m_buildScheduled;
+    int m_depth;
+    QAtomicInt m_generation;
+    QList<QPointer<XYChart>> m_charts;
+    QList<QPointer<XYChart>> m_building;
+    QThreadPool *m_pool;
+};
+
+QT_END_NAMESPACE
+
+#endif // XYGEOMETRYBATCH_P_H
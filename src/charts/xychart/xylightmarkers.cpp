@@ -0,0 +1,128 @@
+/****************************************************************************
+**
+** Copyright (C) 2021 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include <private/xylightmarkers_p.h>
+#include <QtGui/QPaintDevice>
+
+QT_BEGIN_NAMESPACE
+
+XYLightMarkers::XYLightMarkers()
+    : m_markerKey(0),
+      m_devicePixelRatio(1.0)
+{
+}
+
+// The points may only cover a part of the series, firstIndex is the index of the first of
+// them in the series and in the configuration
+void XYLightMarkers::setPoints(
+        const QList<QPointF> &points, int firstIndex,
+        const QHash<int, QHash<QXYSeries::PointConfiguration, QVariant>> &configuration,
+        const QImage &marker)
+{
+    if (marker.isNull()) {
+        m_fragments = QList<QPainter::PixmapFragment>();
+        m_pixmap = QPixmap();
+        m_markerKey = 0;
+        return;
+    }
+
+    m_fragments.clear();
+    m_fragments.reserve(points.size());
+    for (int i = 0; i < points.size(); ++i) {
+        // Light markers are independent of the points visibility of the series, but the
+        // visibility of a single point is still respected
+        if (!configuration.isEmpty()) {
+            const auto conf = configuration.constFind(firstIndex + i);
+            if (conf != configuration.cend()
+                    && !conf->value(QXYSeries::PointConfiguration::Visibility, true).toBool()) {
+                continue;
+            }
+        }
+        QPainter::PixmapFragment fragment;
+        fragment.x = points.at(i).x();
+        fragment.y = points.at(i).y();
+        fragment.rotation = 0;
+        fragment.opacity = 1;
+        m_fragments.append(fragment);
+    }
+    updateFragments();
+}
+
+void XYLightMarkers::paint(QPainter *painter, const QImage &marker)
+{
+    if (marker.isNull() || m_fragments.isEmpty())
+        return;
+
+    const qreal dpr = painter->device() ? painter->device()->devicePixelRatioF() : 1.0;
+    if (marker.cacheKey() != m_markerKey || dpr != m_devicePixelRatio || m_pixmap.isNull()) {
+        updatePixmap(marker, dpr);
+        updateFragments();
+    }
+
+    painter->drawPixmapFragments(m_fragments.constData(), m_fragments.size(), m_pixmap);
+}
+
+// The marker is painted at the size of the image in device independent pixels, like
+// QPainter::drawImage() does, but scaled only once instead of on every paint.
+void XYLightMarkers::updatePixmap(const QImage &marker, qreal devicePixelRatio)
+{
+    m_markerKey = marker.cacheKey();
+    m_devicePixelRatio = devicePixelRatio;
+
+    const QSizeF size = QSizeF(marker.size()) / marker.devicePixelRatio();
+    const QSize pixelSize = (size * devicePixelRatio).toSize();
+    if (pixelSize.isEmpty() || pixelSize == marker.size()) {
+        m_pixmap = QPixmap::fromImage(marker);
+    } else {
+        m_pixmap = QPixmap::fromImage(marker.scaled(pixelSize, Qt::IgnoreAspectRatio,
+                                                    Qt::SmoothTransformation));
+    }
+    m_pixmap.setDevicePixelRatio(qreal(m_pixmap.width()) / size.width());
+}
+
+// The fragments are centered on the points, and scaled back from device pixels to the
+// logical size of the marker.
+void XYLightMarkers::updateFragments()
+{
+    if (m_pixmap.isNull())
+        return;
+
+    const qreal scale = 1.0 / m_pixmap.devicePixelRatio();
+    for (QPainter::PixmapFragment &fragment : m_fragments) {
+        fragment.sourceLeft = 0;
+        fragment.sourceTop = 0;
+        fragment.width = m_pixmap.width();
+        fragment.height = m_pixmap.height();
+        fragment.scaleX = scale;
+        fragment.scaleY = scale;
+    }
+}
+
+QT_END_NAMESPACE
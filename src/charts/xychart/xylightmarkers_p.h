@@ -0,0 +1,79 @@
+/****************************************************************************
+**
+** Copyright (C) 2021 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt Chart API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+
+#ifndef XYLIGHTMARKERS_P_H
+#define XYLIGHTMARKERS_P_H
+
+#include <QtCharts/private/qchartglobal_p.h>
+#include <QtCharts/QXYSeries>
+#include <QtCore/QHash>
+#include <QtCore/QList>
+#include <QtCore/QVariant>
+#include <QtGui/QImage>
+#include <QtGui/QPainter>
+#include <QtGui/QPixmap>
+
+QT_BEGIN_NAMESPACE
+
+// Paints the light markers of a series in one batch. The visible markers are resolved from
+// the points configuration when the geometry or the marker changes, and the marker image is
+// converted once to a pixmap that matches the device pixel ratio of the target. Nothing is
+// kept for series without a light marker.
+class Q_CHARTS_PRIVATE_EXPORT XYLightMarkers
+{
+public:
+    XYLightMarkers();
+
+    void setPoints(const QList<QPointF> &points, int firstIndex,
+                   const QHash<int, QHash<QXYSeries::PointConfiguration, QVariant>> &configuration,
+                   const QImage &marker);
+    void paint(QPainter *painter, const QImage &marker);
+
+private:
+    void updatePixmap(const QImage &marker, qreal devicePixelRatio);
+    void updateFragments();
+
+    QList<QPainter::PixmapFragment> m_fragments;
+    QPixmap m_pixmap;
+    qint64 m_markerKey;
+    qreal m_devicePixelRatio;
+};
+
+QT_END_NAMESPACE
+
+#endif // XYLIGHTMARKERS_P_H
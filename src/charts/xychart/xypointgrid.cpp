@@ -0,0 +1,195 @@
+/****************************************************************************
+**
+** Copyright (C) 2021 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <private/xypointgrid_p.h>
+#include <QtCore/QtMath>
+#include <limits>
+
+QT_BEGIN_NAMESPACE
+
+XYPointGrid::XYPointGrid()
+    : m_valid(false),
+      m_changed(false),
+      m_cellSize(0.0),
+      m_revision(0),
+      m_count(0),
+      m_base(0)
+{
+}
+
+void XYPointGrid::invalidate()
+{
+    m_valid = false;
+    m_changed = false;
+    m_cells.clear();
+}
+
+// Adds the points inserted at index, points being the geometry after the insertion
+void XYPointGrid::pointsInserted(quint64 revision, const QList<QPointF> &points, int index,
+                                 int count)
+{
+    if (!follows(revision) || index < 0 || index > m_count)
+        return;
+    if (index < m_count)
+        shiftKeys(index, count);
+    for (int i = index; i < index + count; ++i)
+        addKey(points.at(i), i + m_base);
+    m_count += count;
+    m_changed = true;
+}
+
+// Removes the points at index, oldPoints being the geometry before the removal
+void XYPointGrid::pointsRemoved(quint64 revision, const QList<QPointF> &oldPoints, int index,
+                                int count)
+{
+    if (!follows(revision) || index < 0 || index + count > m_count)
+        return;
+    for (int i = index; i < index + count; ++i)
+        removeKey(oldPoints.at(i), i + m_base);
+    if (index == 0 && m_base < std::numeric_limits<int>::max() / 2)
+        m_base += count;
+    else if (index + count < m_count)
+        shiftKeys(index + count, -count);
+    m_count -= count;
+    m_changed = true;
+}
+
+void XYPointGrid::pointsReplaced(quint64 revision, const QList<QPointF> &oldPoints,
+                                 const QList<QPointF> &newPoints, int index, int count)
+{
+    if (!follows(revision) || index < 0 || index + count > m_count)
+        return;
+    for (int i = index; i < index + count; ++i) {
+        removeKey(oldPoints.at(i), i + m_base);
+        addKey(newPoints.at(i), i + m_base);
+    }
+    m_changed = true;
+}
+
+// Called after each change of the geometry with its new revision. The grid is kept if the
+// change was applied to it, otherwise it is rebuilt on the next query.
+void XYPointGrid::geometryChanged(quint64 revision)
+{
+    if (m_changed && m_valid && m_revision + 1 == revision) {
+        m_revision = revision;
+        m_changed = false;
+    } else {
+        invalidate();
+    }
+}
+
+// Returns the indexes of the points within the rect, in no particular order. The cell
+// size should be about the size of the rect, so that only a few cells are visited.
+QList<int> XYPointGrid::pointsIn(const QList<QPointF> &points, quint64 revision,
+                                 const QRectF &rect, qreal cellSize)
+{
+    cellSize = qMax(cellSize, qreal(1.0));
+    if (!follows(revision) || m_cellSize != cellSize || m_count != points.size())
+        build(points, cellSize);
+    m_revision = revision;
+
+    QList<int> result;
+    const QPoint first = cell(rect.topLeft());
+    const QPoint last = cell(rect.bottomRight());
+    const qint64 cellCount = qint64(last.x() - first.x() + 1) * (last.y() - first.y() + 1);
+    if (cellCount > MaxQueryCells) {
+        // The rect is large compared to the cells, checking all the points is faster
+        for (int i = 0; i < points.size(); ++i) {
+            if (rect.contains(points.at(i)))
+                result.append(i);
+        }
+        return result;
+    }
+
+    for (int x = first.x(); x <= last.x(); ++x) {
+        for (int y = first.y(); y <= last.y(); ++y) {
+            const auto found = m_cells.constFind(QPoint(x, y));
+            if (found == m_cells.cend())
+                continue;
+            for (int key : *found) {
+                const int index = key - m_base;
+                if (rect.contains(points.at(index)))
+                    result.append(index);
+            }
+        }
+    }
+    return result;
+}
+
+void XYPointGrid::build(const QList<QPointF> &points, qreal cellSize)
+{
+    m_cells.clear();
+    m_cellSize = cellSize;
+    m_count = int(points.size());
+    m_base = 0;
+    for (int i = 0; i < points.size(); ++i)
+        addKey(points.at(i), i);
+    m_valid = true;
+    m_changed = false;
+}
+
+QPoint XYPointGrid::cell(const QPointF &point) const
+{
+    // Points far outside the plot area end up in the outermost cells
+    const qreal limit = 1e9;
+    return QPoint(int(qBound(-limit, std::floor(point.x() / m_cellSize), limit)),
+                  int(qBound(-limit, std::floor(point.y() / m_cellSize), limit)));
+}
+
+void XYPointGrid::addKey(const QPointF &point, int key)
+{
+    if (qIsFinite(point.x()) && qIsFinite(point.y()))
+        m_cells[cell(point)].append(key);
+}
+
+void XYPointGrid::removeKey(const QPointF &point, int key)
+{
+    if (!qIsFinite(point.x()) || !qIsFinite(point.y()))
+        return;
+    auto found = m_cells.find(cell(point));
+    if (found != m_cells.end()) {
+        found->removeOne(key);
+        if (found->isEmpty())
+            m_cells.erase(found);
+    }
+}
+
+// Renumbers the points from index on after points were inserted or removed before them
+void XYPointGrid::shiftKeys(int index, int delta)
+{
+    const int first = index + m_base;
+    for (QList<int> &keys : m_cells) {
+        for (int &key : keys) {
+            if (key >= first)
+                key += delta;
+        }
+    }
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,95 @@
+/****************************************************************************
+**
+** Copyright (C) 2021 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt Chart API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+
+#ifndef XYPOINTGRID_P_H
+#define XYPOINTGRID_P_H
+
+#include <QtCharts/private/qchartglobal_p.h>
+#include <QtCore/QHash>
+#include <QtCore/QList>
+#include <QtCore/QPoint>
+#include <QtCore/QRectF>
+
+QT_BEGIN_NAMESPACE
+
+// Finds the geometry points within a small rect, for resolving the marker under the
+// mouse in O(1) expected time. The points are bucketed into a uniform grid of square
+// cells in pixel space. The grid remembers the revision of the geometry it was built
+// from, and is rebuilt on the next query when the geometry has changed since.
+// Changes that are applied to the grid as well, before the revision of the geometry is
+// increased with geometryChanged(), keep it up to date instead. Appending points and
+// removing points from the front only touches the cells of those points.
+class Q_CHARTS_PRIVATE_EXPORT XYPointGrid
+{
+public:
+    XYPointGrid();
+
+    void invalidate();
+    void pointsInserted(quint64 revision, const QList<QPointF> &points, int index, int count);
+    void pointsRemoved(quint64 revision, const QList<QPointF> &oldPoints, int index, int count);
+    void pointsReplaced(quint64 revision, const QList<QPointF> &oldPoints,
+                        const QList<QPointF> &newPoints, int index, int count);
+    void geometryChanged(quint64 revision);
+
+    QList<int> pointsIn(const QList<QPointF> &points, quint64 revision, const QRectF &rect,
+                        qreal cellSize);
+
+private:
+    bool follows(quint64 revision) const { return m_valid && m_revision == revision; }
+    void build(const QList<QPointF> &points, qreal cellSize);
+    QPoint cell(const QPointF &point) const;
+    void addKey(const QPointF &point, int key);
+    void removeKey(const QPointF &point, int key);
+    void shiftKeys(int index, int delta);
+
+    static const int MaxQueryCells = 64;
+
+    bool m_valid;
+    bool m_changed;
+    qreal m_cellSize;
+    quint64 m_revision;
+    int m_count;
+    // The cells hold the index of a point plus the base, so that removing points from the
+    // front doesn't need to renumber the rest
+    int m_base;
+    QHash<QPoint, QList<int>> m_cells;
+};
+
+QT_END_NAMESPACE
+
+#endif // XYPOINTGRID_P_H
@@ -0,0 +1,128 @@
+/****************************************************************************
+**
+** Copyright (C) 2021 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <private/xypointlabels_p.h>
+#include <QtGui/QFontMetricsF>
+#include <QtGui/QTransform>
+#include <cmath>
+
+QT_BEGIN_NAMESPACE
+
+XYPointLabelCache::XYPointLabelCache()
+    : m_localizeNumbers(false),
+      m_maxLabelWidth(0.0)
+{
+}
+
+void XYPointLabelCache::setStyle(const QString &format, const QFont &font, const QLocale &locale,
+                                 bool localizeNumbers)
+{
+    if (format == m_format && font == m_font && locale == m_locale
+            && localizeNumbers == m_localizeNumbers) {
+        return;
+    }
+    m_labels.clear();
+    m_format = format;
+    m_font = font;
+    m_locale = locale;
+    m_localizeNumbers = localizeNumbers;
+
+    // Every number is assumed to be as long as the longest one, in the widest character
+    static const QString xPointTag(QLatin1String("@xPoint"));
+    static const QString yPointTag(QLatin1String("@yPoint"));
+    const QFontMetricsF fm(m_font);
+    const qsizetype tags = format.count(xPointTag) + format.count(yPointTag);
+    QString text = format;
+    text.remove(xPointTag);
+    text.remove(yPointTag);
+    m_maxLabelWidth = fm.horizontalAdvance(text) + tags * MaxNumberLength * fm.maxWidth();
+}
+
+bool XYPointLabelCache::find(const QPointF &value, QStaticText &label) const
+{
+    const auto found = m_labels.constFind(qMakePair(value.x(), value.y()));
+    if (found == m_labels.cend())
+        return false;
+    label = *found;
+    return true;
+}
+
+QStaticText XYPointLabelCache::insert(const QPointF &value, const QString &text)
+{
+    QStaticText label(text);
+    label.setTextFormat(Qt::PlainText);
+    // Lays the text out with the label font, so that its size is known before drawing
+    label.prepare(QTransform(), m_font);
+    m_labels.insert(qMakePair(value.x(), value.y()), label);
+    return label;
+}
+
+// The labels of values that are no longer in the series are not removed one by one,
+// the cache is dropped when it has grown well beyond the size of the series.
+void XYPointLabelCache::trim(qsizetype pointCount)
+{
+    if (m_labels.size() > 2 * pointCount + 64)
+        m_labels.clear();
+}
+
+XYPointLabelGrid::XYPointLabelGrid(qreal cellSize)
+    : m_cellSize(qMax(cellSize, qreal(1.0)))
+{
+}
+
+bool XYPointLabelGrid::place(const QRectF &rect)
+{
+    const QPoint first = cell(rect.topLeft());
+    const QPoint last = cell(rect.bottomRight());
+    for (int x = first.x(); x <= last.x(); ++x) {
+        for (int y = first.y(); y <= last.y(); ++y) {
+            const auto found = m_cells.constFind(QPoint(x, y));
+            if (found == m_cells.cend())
+                continue;
+            for (const QRectF &placed : *found) {
+                if (placed.intersects(rect))
+                    return false;
+            }
+        }
+    }
+    for (int x = first.x(); x <= last.x(); ++x) {
+        for (int y = first.y(); y <= last.y(); ++y)
+            m_cells[QPoint(x, y)].append(rect);
+    }
+    return true;
+}
+
+QPoint XYPointLabelGrid::cell(const QPointF &point) const
+{
+    const qreal limit = 1e9;
+    return QPoint(int(qBound(-limit, std::floor(point.x() / m_cellSize), limit)),
+                  int(qBound(-limit, std::floor(point.y() / m_cellSize), limit)));
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,103 @@
+/****************************************************************************
+**
+** Copyright (C) 2021 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt Chart API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+
+#ifndef XYPOINTLABELS_P_H
+#define XYPOINTLABELS_P_H
+
+#include <QtCharts/private/qchartglobal_p.h>
+#include <QtCore/QHash>
+#include <QtCore/QList>
+#include <QtCore/QLocale>
+#include <QtCore/QPair>
+#include <QtCore/QPoint>
+#include <QtCore/QRectF>
+#include <QtGui/QFont>
+#include <QtGui/QStaticText>
+
+QT_BEGIN_NAMESPACE
+
+// Formatted point labels, keyed by the values of the points, so that the labels of points
+// that keep their values are not formatted and laid out again on every paint. The labels
+// are dropped when the format, the font or the number formatting changes.
+class Q_CHARTS_PRIVATE_EXPORT XYPointLabelCache
+{
+public:
+    XYPointLabelCache();
+
+    void setStyle(const QString &format, const QFont &font, const QLocale &locale,
+                  bool localizeNumbers);
+    bool find(const QPointF &value, QStaticText &label) const;
+    QStaticText insert(const QPointF &value, const QString &text);
+    void trim(qsizetype pointCount);
+    qsizetype count() const { return m_labels.size(); }
+
+    // An upper bound of the width of any label in the current style. Points whose labels
+    // can't reach the clip are skipped with it, before their labels are looked up.
+    qreal maxLabelWidth() const { return m_maxLabelWidth; }
+
+    // The longest number the default formatting produces, like -1.23457e+308
+    static const int MaxNumberLength = 16;
+
+private:
+    QHash<QPair<qreal, qreal>, QStaticText> m_labels;
+    QString m_format;
+    QFont m_font;
+    QLocale m_locale;
+    bool m_localizeNumbers;
+    qreal m_maxLabelWidth;
+};
+
+// Places labels in the order they are drawn, and rejects the ones that overlap a label that
+// was already placed. The placed labels are bucketed into a uniform grid of square cells.
+class Q_CHARTS_PRIVATE_EXPORT XYPointLabelGrid
+{
+public:
+    explicit XYPointLabelGrid(qreal cellSize);
+
+    bool place(const QRectF &rect);
+
+private:
+    QPoint cell(const QPointF &point) const;
+
+    qreal m_cellSize;
+    QHash<QPoint, QList<QRectF>> m_cells;
+};
+
+QT_END_NAMESPACE
+
+#endif // XYPOINTLABELS_P_H
@@ -0,0 +1,174 @@
+/****************************************************************************
+**
+** Copyright (C) 2021 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <private/xyrangeindex_p.h>
+#include <QtCore/QtNumeric>
+
+QT_BEGIN_NAMESPACE
+
+XYRangeIndex::XYRangeIndex()
+    : m_valid(false),
+      m_count(0),
+      m_leafCount(0)
+{
+}
+
+void XYRangeIndex::pointsAppended(const QList<QPointF> &points, int index)
+{
+    if (!m_valid)
+        return;
+
+    const int count = points.count();
+    if (index != m_count || (count - 1) / BlockSize >= m_leafCount) {
+        // Not an append to the indexed points, or the tree is full
+        m_valid = false;
+        return;
+    }
+
+    for (int i = index; i < count; ++i) {
+        const int node = m_leafCount + i / BlockSize;
+        const qreal y = points.at(i).y();
+        if (y < m_min.at(node) || y > m_max.at(node)) {
+            m_min[node] = qMin(m_min.at(node), y);
+            m_max[node] = qMax(m_max.at(node), y);
+            updateParents(node);
+        }
+    }
+    m_count = count;
+}
+
+void XYRangeIndex::pointReplaced(const QList<QPointF> &points, int index)
+{
+    if (!m_valid)
+        return;
+
+    if (points.count() != m_count) {
+        m_valid = false;
+        return;
+    }
+
+    updateBlock(points, index / BlockSize);
+}
+
+// Returns the y range of the points from first to last, both included
+bool XYRangeIndex::rangeY(const QList<QPointF> &points, int first, int last,
+                          qreal &minY, qreal &maxY)
+{
+    if (first < 0 || last >= points.count() || first > last)
+        return false;
+
+    if (!m_valid || m_count != points.count())
+        build(points);
+
+    minY = qInf();
+    maxY = -qInf();
+
+    const int firstBlock = first / BlockSize;
+    const int lastBlock = last / BlockSize;
+
+    // Partial blocks at the ends are scanned, whole blocks in between come from the tree
+    const int firstEnd = (firstBlock == lastBlock) ? last : (firstBlock + 1) * BlockSize - 1;
+    for (int i = first; i <= firstEnd; ++i) {
+        minY = qMin(minY, points.at(i).y());
+        maxY = qMax(maxY, points.at(i).y());
+    }
+    if (firstBlock == lastBlock)
+        return true;
+
+    for (int i = lastBlock * BlockSize; i <= last; ++i) {
+        minY = qMin(minY, points.at(i).y());
+        maxY = qMax(maxY, points.at(i).y());
+    }
+
+    int left = m_leafCount + firstBlock + 1;
+    int right = m_leafCount + lastBlock;
+    while (left < right) {
+        if (left & 1) {
+            minY = qMin(minY, m_min.at(left));
+            maxY = qMax(maxY, m_max.at(left));
+            ++left;
+        }
+        if (right & 1) {
+            --right;
+            minY = qMin(minY, m_min.at(right));
+            maxY = qMax(maxY, m_max.at(right));
+        }
+        left /= 2;
+        right /= 2;
+    }
+    return true;
+}
+
+void XYRangeIndex::build(const QList<QPointF> &points)
+{
+    m_count = points.count();
+    const int blockCount = (m_count + BlockSize - 1) / BlockSize;
+
+    // Leave room for appending by rounding the leaves up to a power of two
+    m_leafCount = 1;
+    while (m_leafCount < blockCount)
+        m_leafCount *= 2;
+
+    m_min.fill(qInf(), 2 * m_leafCount);
+    m_max.fill(-qInf(), 2 * m_leafCount);
+
+    for (int i = 0; i < m_count; ++i) {
+        const int node = m_leafCount + i / BlockSize;
+        m_min[node] = qMin(m_min.at(node), points.at(i).y());
+        m_max[node] = qMax(m_max.at(node), points.at(i).y());
+    }
+    for (int node = m_leafCount - 1; node > 0; --node) {
+        m_min[node] = qMin(m_min.at(2 * node), m_min.at(2 * node + 1));
+        m_max[node] = qMax(m_max.at(2 * node), m_max.at(2 * node + 1));
+    }
+    m_valid = true;
+}
+
+void XYRangeIndex::updateBlock(const QList<QPointF> &points, int block)
+{
+    const int node = m_leafCount + block;
+    const int end = qMin(m_count, (block + 1) * BlockSize);
+    m_min[node] = qInf();
+    m_max[node] = -qInf();
+    for (int i = block * BlockSize; i < end; ++i) {
+        m_min[node] = qMin(m_min.at(node), points.at(i).y());
+        m_max[node] = qMax(m_max.at(node), points.at(i).y());
+    }
+    updateParents(node);
+}
+
+void XYRangeIndex::updateParents(int node)
+{
+    for (node /= 2; node > 0; node /= 2) {
+        m_min[node] = qMin(m_min.at(2 * node), m_min.at(2 * node + 1));
+        m_max[node] = qMax(m_max.at(2 * node), m_max.at(2 * node + 1));
+    }
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,80 @@
+/****************************************************************************
+**
+** Copyright (C) 2021 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt Chart API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+
+#ifndef XYRANGEINDEX_P_H
+#define XYRANGEINDEX_P_H
+
+#include <QtCharts/private/qchartglobal_p.h>
+#include <QtCore/QList>
+#include <QtCore/QPointF>
+
+QT_BEGIN_NAMESPACE
+
+// Answers min/max y queries over any index range of the points in O(log n).
+// The points are grouped into blocks, whose y ranges are kept in a segment tree.
+// Appending points and replacing single points update the tree in place, any other
+// change invalidates it and it is rebuilt on the next query.
+class Q_CHARTS_PRIVATE_EXPORT XYRangeIndex
+{
+public:
+    XYRangeIndex();
+
+    void invalidate() { m_valid = false; }
+    void pointsAppended(const QList<QPointF> &points, int index);
+    void pointReplaced(const QList<QPointF> &points, int index);
+
+    bool rangeY(const QList<QPointF> &points, int first, int last, qreal &minY, qreal &maxY);
+
+private:
+    void build(const QList<QPointF> &points);
+    void updateBlock(const QList<QPointF> &points, int block);
+    void updateParents(int node);
+
+    static const int BlockSize = 64;
+
+    bool m_valid;
+    int m_count;
+    int m_leafCount;
+    QList<qreal> m_min;
+    QList<qreal> m_max;
+};
+
+QT_END_NAMESPACE
+
+#endif // XYRANGEINDEX_P_H
@@ -0,0 +1,158 @@
+/****************************************************************************
+**
+** Copyright (C) 2021 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <private/xysegmentindex_p.h>
+#include <QtCore/QtMath>
+
+QT_BEGIN_NAMESPACE
+
+namespace {
+
+qreal distanceToSegment(const QPointF &point, const QLineF &segment)
+{
+    const QPointF delta = segment.p2() - segment.p1();
+    const qreal lengthSquared = QPointF::dotProduct(delta, delta);
+    qreal t = 0.0;
+    if (lengthSquared > 0.0)
+        t = qBound(0.0, QPointF::dotProduct(point - segment.p1(), delta) / lengthSquared, 1.0);
+    const QPointF closest = segment.p1() + t * delta;
+    return QLineF(point, closest).length();
+}
+
+}
+
+XYSegmentIndex::XYSegmentIndex()
+    : m_tolerance(0.0),
+      m_cellSize(1.0),
+      m_built(false)
+{
+}
+
+void XYSegmentIndex::setPath(const QPainterPath &path, qreal tolerance)
+{
+    m_path = path;
+    m_polylines.clear();
+    reset(tolerance);
+}
+
+void XYSegmentIndex::setPolylines(const QList<QPolygonF> &polylines, qreal tolerance)
+{
+    m_path = QPainterPath();
+    m_polylines = polylines;
+    reset(tolerance);
+}
+
+void XYSegmentIndex::reset(qreal tolerance)
+{
+    m_tolerance = tolerance;
+    m_built = false;
+    m_segments.clear();
+    m_largeSegments.clear();
+    m_cells.clear();
+}
+
+// The rect is treated as its center point, with the tolerance grown by half of the
+// diagonal of the rect. The queries from the scene are single pixels.
+bool XYSegmentIndex::intersects(const QRectF &rect)
+{
+    if (!m_built)
+        build();
+
+    const QPointF center = rect.center();
+    const qreal tolerance = m_tolerance + QLineF(rect.topLeft(), rect.bottomRight()).length() / 2.0;
+
+    for (int index : qAsConst(m_largeSegments)) {
+        if (distanceToSegment(center, m_segments.at(index)) <= tolerance)
+            return true;
+    }
+
+    const QPoint first = cell(center - QPointF(tolerance, tolerance));
+    const QPoint last = cell(center + QPointF(tolerance, tolerance));
+    for (int x = first.x(); x <= last.x(); ++x) {
+        for (int y = first.y(); y <= last.y(); ++y) {
+            const auto found = m_cells.constFind(QPoint(x, y));
+            if (found == m_cells.cend())
+                continue;
+            for (int index : *found) {
+                if (distanceToSegment(center, m_segments.at(index)) <= tolerance)
+                    return true;
+            }
+        }
+    }
+    return false;
+}
+
+void XYSegmentIndex::build()
+{
+    m_built = true;
+    // Cells of about twice the tolerance keep both the number of cells per segment and
+    // the number of segments per cell small
+    m_cellSize = qMax(qreal(8.0), 2.0 * m_tolerance);
+
+    // Curves, like the ellipses of the points of polar charts, are flattened
+    const QList<QPolygonF> polygons = m_path.isEmpty() ? m_polylines
+                                                       : m_path.toSubpathPolygons();
+    for (const QPolygonF &polygon : polygons) {
+        if (polygon.size() == 1)
+            m_segments.append(QLineF(polygon.first(), polygon.first()));
+        for (int i = 1; i < polygon.size(); ++i)
+            m_segments.append(QLineF(polygon.at(i - 1), polygon.at(i)));
+    }
+
+    for (int i = 0; i < m_segments.size(); ++i) {
+        const QLineF &segment = m_segments.at(i);
+        if (!qIsFinite(segment.x1()) || !qIsFinite(segment.y1())
+                || !qIsFinite(segment.x2()) || !qIsFinite(segment.y2())) {
+            continue;
+        }
+        const QRectF bounds = QRectF(segment.p1(), segment.p2()).normalized()
+                .adjusted(-m_tolerance, -m_tolerance, m_tolerance, m_tolerance);
+        const QPoint first = cell(bounds.topLeft());
+        const QPoint last = cell(bounds.bottomRight());
+        const qint64 cellCount = qint64(last.x() - first.x() + 1) * (last.y() - first.y() + 1);
+        // Long segments would fill too many cells, they are always checked instead
+        if (cellCount > MaxSegmentCells) {
+            m_largeSegments.append(i);
+            continue;
+        }
+        for (int x = first.x(); x <= last.x(); ++x) {
+            for (int y = first.y(); y <= last.y(); ++y)
+                m_cells[QPoint(x, y)].append(i);
+        }
+    }
+}
+
+QPoint XYSegmentIndex::cell(const QPointF &point) const
+{
+    const qreal limit = 1e9;
+    return QPoint(int(qBound(-limit, std::floor(point.x() / m_cellSize), limit)),
+                  int(qBound(-limit, std::floor(point.y() / m_cellSize), limit)));
+}
+
+QT_END_NAMESPACE
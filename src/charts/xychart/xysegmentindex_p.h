@@ -0,0 +1,85 @@
+/****************************************************************************
+**
+** Copyright (C) 2021 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt Chart API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+
+#ifndef XYSEGMENTINDEX_P_H
+#define XYSEGMENTINDEX_P_H
+
+#include <QtCharts/private/qchartglobal_p.h>
+#include <QtCore/QHash>
+#include <QtCore/QLineF>
+#include <QtCore/QList>
+#include <QtCore/QPoint>
+#include <QtCore/QRectF>
+#include <QtGui/QPainterPath>
+#include <QtGui/QPolygonF>
+
+QT_BEGIN_NAMESPACE
+
+// Hit tests the outline of a path or of polylines without stroking them. A rect hits the
+// line when it is within the tolerance of one of its segments. The segments are bucketed
+// into a uniform grid, which is only built when the first query arrives after the line
+// changed.
+class Q_CHARTS_PRIVATE_EXPORT XYSegmentIndex
+{
+public:
+    XYSegmentIndex();
+
+    void setPath(const QPainterPath &path, qreal tolerance);
+    void setPolylines(const QList<QPolygonF> &polylines, qreal tolerance);
+    bool intersects(const QRectF &rect);
+
+private:
+    void reset(qreal tolerance);
+    void build();
+    QPoint cell(const QPointF &point) const;
+
+    static const int MaxSegmentCells = 64;
+
+    QPainterPath m_path;
+    QList<QPolygonF> m_polylines;
+    qreal m_tolerance;
+    qreal m_cellSize;
+    bool m_built;
+    QList<QLineF> m_segments;
+    QList<int> m_largeSegments;
+    QHash<QPoint, QList<int>> m_cells;
+};
+
+QT_END_NAMESPACE
+
+#endif // XYSEGMENTINDEX_P_H
@@ -230,10 +230,11 @@ void DeclarativeOpenGLRenderNode::setSeriesData(bool mapDirty, const GLXYDataMap
         for (auto i = dataMap.begin(), end = dataMap.end(); i != end; ++i) {
             GLXYSeriesData *data = oldMap.take(i.key());
             const GLXYSeriesData *newData = i.value();
-            if (!data || newData->dirty) {
-                if (!data)
-                    data = new GLXYSeriesData;
+            if (!data) {
+                data = new GLXYSeriesData;
                 *data = *newData;
+            } else if (newData->dirty) {
+                updateSeriesData(data, newData);
             }
             m_xyDataMap.insert(i.key(), data);
         }
@@ -251,7 +252,7 @@ void DeclarativeOpenGLRenderNode::setSeriesData(bool mapDirty, const GLXYDataMap
                 dirty = true;
                 GLXYSeriesData *data = m_xyDataMap.value(i.key());
                 if (data)
-                    *data = *newData;
+                    updateSeriesData(data, newData);
             }
         }
     }
@@ -262,6 +263,33 @@ void DeclarativeOpenGLRenderNode::setSeriesData(bool mapDirty, const GLXYDataMap
     }
 }
 
+// The parts of the array that were not uploaded yet are kept dirty, as the data can be
+// updated several times before it is rendered. The position of the array in the buffer
+// belongs to the node.
+void DeclarativeOpenGLRenderNode::updateSeriesData(GLXYSeriesData *data,
+                                                   const GLXYSeriesData *newData)
+{
+    const bool pending = data->dirty;
+    const int dirtyBegin = data->arrayDirtyBegin;
+    const int dirtyEnd = data->arrayDirtyEnd;
+    const int removedFront = data->arrayRemovedFront;
+    const int bufferOffset = data->bufferOffset;
+    *data = *newData;
+    data->bufferOffset = bufferOffset;
+    if (pending) {
+        // The pending range is relative to the array before the new removals
+        const int newBegin = data->arrayDirtyBegin;
+        const int newEnd = data->arrayDirtyEnd;
+        const int newRemovedFront = data->arrayRemovedFront;
+        data->arrayDirtyBegin = dirtyBegin;
+        data->arrayDirtyEnd = dirtyEnd;
+        data->arrayRemovedFront = removedFront;
+        data->removeArrayFront(newRemovedFront);
+        if (newBegin < newEnd)
+            data->markArrayDirty(newBegin, newEnd);
+    }
+}
+
 void DeclarativeOpenGLRenderNode::setRect(const QRectF &rect)
 {
     m_rect = rect;
@@ -328,20 +356,21 @@ void DeclarativeOpenGLRenderNode::renderGL(bool selection)
                 vbo = new QOpenGLBuffer;
                 m_seriesBufferMap.insert(i.key(), vbo);
                 vbo->create();
+                data->markArrayDirty(0, data->array.size());
             }
             vbo->bind();
             if (data->dirty) {
-                vbo->allocate(data->array.constData(), data->array.count() * sizeof(GLfloat));
+                GLXYSeriesDataManager::uploadArray(vbo, data);
                 data->dirty = false;
             }
 
             glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, 0);
             if (data->type == QAbstractSeries::SeriesTypeLine) {
                 glLineWidth(data->width);
-                glDrawArrays(GL_LINE_STRIP, 0, data->array.size() / 2);
+                glDrawArrays(GL_LINE_STRIP, data->bufferOffset / 2, data->array.size() / 2);
             } else { // Scatter
                 m_program->setUniformValue(m_pointSizeUniformLoc, data->width);
-                glDrawArrays(GL_POINTS, 0, data->array.size() / 2);
+                glDrawArrays(GL_POINTS, data->bufferOffset / 2, data->array.size() / 2);
             }
             vbo->release();
         }
@@ -74,6 +74,7 @@ public Q_SLOTS:
     void render();
 
 private:
+    void updateSeriesData(GLXYSeriesData *data, const GLXYSeriesData *newData);
     void renderGL(bool selection);
     void renderSelection();
     void renderVisual();
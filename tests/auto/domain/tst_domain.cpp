@@ -28,7 +28,11 @@
 ****************************************************************************/
 #include <QtTest/QtTest>
 #include <QtCharts/private/xydomain_p.h>
+#include <QtCharts/private/logxlogydomain_p.h>
+#include <QtCharts/private/xypolardomain_p.h>
+#include <QtCharts/private/logxlogypolardomain_p.h>
 #include <QtCharts/private/qabstractaxis_p.h>
+#include <QtCharts/private/domaintransforms_p.h>
 #include <tst_definitions.h>
 
 QT_USE_NAMESPACE
@@ -128,6 +132,13 @@ private Q_SLOTS:
     void zoomOut();
     void move_data();
     void move();
+    void calculateVisibleGeometryPoints_data();
+    void calculateVisibleGeometryPoints();
+    void calculateGeometryPoints_data();
+    void calculateGeometryPoints();
+    void calculateGeometryPointsInvalid();
+    void calculateGeometryPointsKernels_data();
+    void calculateGeometryPointsKernels();
 };
 
 void tst_Domain::initTestCase()
@@ -728,5 +739,180 @@ void tst_Domain::move()
     TRY_COMPARE(spy2.count(), (dy != 0 ? 1 : 0));
 }
 
+void tst_Domain::calculateVisibleGeometryPoints_data()
+{
+    QTest::addColumn<qreal>("minX");
+    QTest::addColumn<qreal>("maxX");
+    QTest::addColumn<int>("first");
+    QTest::addColumn<int>("last");
+    QTest::newRow("all visible") << qreal(-10) << qreal(200) << 0 << 99;
+    QTest::newRow("middle") << qreal(20.5) << qreal(30.5) << 20 << 31;
+    QTest::newRow("on points") << qreal(20) << qreal(30) << 19 << 31;
+    QTest::newRow("left edge") << qreal(0) << qreal(10) << 0 << 11;
+    QTest::newRow("right edge") << qreal(90) << qreal(99) << 89 << 99;
+    QTest::newRow("before data") << qreal(-20) << qreal(-10) << 0 << 0;
+    QTest::newRow("after data") << qreal(120) << qreal(130) << 99 << 99;
+}
+
+void tst_Domain::calculateVisibleGeometryPoints()
+{
+    QFETCH(qreal, minX);
+    QFETCH(qreal, maxX);
+    QFETCH(int, first);
+    QFETCH(int, last);
+
+    QList<QPointF> points;
+    for (int i = 0; i < 100; ++i)
+        points << QPointF(i, i % 7);
+
+    XYDomain domain;
+    domain.setRange(minX, maxX, 0, 10);
+    domain.setSize(QSizeF(1000, 1000));
+
+    int visibleFirst = -1;
+    int visibleLast = -1;
+    domain.visibleIndexRange(points, visibleFirst, visibleLast);
+    QCOMPARE(visibleFirst, first);
+    QCOMPARE(visibleLast, last);
+
+    // Only the visible part of the list is transformed
+    const QList<QPointF> all = domain.calculateGeometryPoints(points);
+    int offset = -1;
+    const QList<QPointF> visible = domain.calculateVisibleGeometryPoints(points, offset);
+    QCOMPARE(offset, first);
+    QCOMPARE(visible, all.mid(first, last - first + 1));
+}
+
+static AbstractDomain *createDomain(const QString &type)
+{
+    if (type == QLatin1String("xy"))
+        return new XYDomain;
+    if (type == QLatin1String("logxlogy"))
+        return new LogXLogYDomain;
+    if (type == QLatin1String("xypolar"))
+        return new XYPolarDomain;
+    if (type == QLatin1String("logxlogypolar"))
+        return new LogXLogYPolarDomain;
+    return nullptr;
+}
+
+void tst_Domain::calculateGeometryPoints_data()
+{
+    QTest::addColumn<QString>("type");
+    QTest::addColumn<bool>("reverseX");
+    QTest::addColumn<bool>("reverseY");
+    QTest::addColumn<int>("count");
+    const QStringList types = { "xy", "logxlogy", "xypolar", "logxlogypolar" };
+    for (const QString &type : types) {
+        // Odd counts also exercise the scalar tail of the vectorized loops
+        for (int count : { 1, 7, 64 }) {
+            const QByteArray name = type.toLatin1() + ' ' + QByteArray::number(count);
+            QTest::newRow(name.constData()) << type << false << false << count;
+            QTest::newRow((name + " reverse x").constData()) << type << true << false << count;
+            QTest::newRow((name + " reverse y").constData()) << type << false << true << count;
+            QTest::newRow((name + " reverse xy").constData()) << type << true << true << count;
+        }
+    }
+}
+
+void tst_Domain::calculateGeometryPoints()
+{
+    QFETCH(QString, type);
+    QFETCH(bool, reverseX);
+    QFETCH(bool, reverseY);
+    QFETCH(int, count);
+
+    QScopedPointer<AbstractDomain> domain(createDomain(type));
+    domain->setRange(1, 1000, 1, 100);
+    domain->setSize(QSizeF(500, 500));
+    domain->setReverseX(reverseX);
+    domain->setReverseY(reverseY);
+
+    QList<QPointF> points;
+    for (int i = 0; i < count; ++i)
+        points << QPointF(1 + i * 13.7, 0.5 + (i % 11) * 9.1);
+
+    const QList<QPointF> result = domain->calculateGeometryPoints(points);
+    QCOMPARE(result.count(), points.count());
+    for (int i = 0; i < points.count(); ++i) {
+        bool ok = false;
+        const QPointF expected = domain->calculateGeometryPoint(points.at(i), ok);
+        QVERIFY(ok);
+        QVERIFY2(qAbs(result.at(i).x() - expected.x()) < 1e-6
+                 && qAbs(result.at(i).y() - expected.y()) < 1e-6,
+                 qPrintable(QString::number(i)));
+    }
+}
+
+void tst_Domain::calculateGeometryPointsInvalid()
+{
+    LogXLogYDomain domain;
+    domain.setRange(1, 1000, 1, 100);
+    domain.setSize(QSizeF(500, 500));
+
+    QList<QPointF> points;
+    for (int i = 1; i < 10; ++i)
+        points << QPointF(i, i);
+    points << QPointF(5, 0);
+
+    QTest::ignoreMessage(QtWarningMsg, "Logarithms of zero and negative values are undefined.");
+    QVERIFY(domain.calculateGeometryPoints(points).isEmpty());
+}
+
+void tst_Domain::calculateGeometryPointsKernels_data()
+{
+    QTest::addColumn<QString>("type");
+    for (const char *type : { "xy", "logxlogy", "xypolar", "logxlogypolar" })
+        QTest::newRow(type) << QString::fromLatin1(type);
+}
+
+// All the instruction sets produce the same results
+void tst_Domain::calculateGeometryPointsKernels()
+{
+    QFETCH(QString, type);
+
+    QScopedPointer<AbstractDomain> domain(createDomain(type));
+    domain->setRange(1, 1000, 1, 100);
+    domain->setSize(QSizeF(500, 500));
+    domain->setReverseY(true);
+
+    QList<QPointF> points;
+    for (int i = 0; i < 101; ++i)
+        points << QPointF(1 + i * 9.3, 0.5 + (i % 11) * 9.1);
+    QList<qreal> x;
+    QList<qreal> y;
+    for (const QPointF &point : qAsConst(points)) {
+        x << point.x();
+        y << point.y();
+    }
+
+    const auto restore = qScopeGuard([] {
+        DomainTransforms::setKernel(DomainTransforms::AutomaticKernel);
+    });
+    QVERIFY(DomainTransforms::setKernel(DomainTransforms::ScalarKernel));
+    QCOMPARE(DomainTransforms::kernel(), DomainTransforms::ScalarKernel);
+    const QList<QPointF> expected = domain->calculateGeometryPoints(points);
+    const QList<QPointF> expectedColumns =
+            domain->calculateGeometryPoints(x.constData(), y.constData(), x.count());
+    QCOMPARE(expected.count(), points.count());
+
+    for (DomainTransforms::Kernel kernel : { DomainTransforms::Sse2Kernel,
+                                             DomainTransforms::Avx2Kernel }) {
+        if (!DomainTransforms::setKernel(kernel))
+            continue;
+        const QList<QPointF> result = domain->calculateGeometryPoints(points);
+        const QList<QPointF> columns =
+                domain->calculateGeometryPoints(x.constData(), y.constData(), x.count());
+        QCOMPARE(result.count(), expected.count());
+        QCOMPARE(columns.count(), expectedColumns.count());
+        for (int i = 0; i < expected.count(); ++i) {
+            QCOMPARE(result.at(i).x(), expected.at(i).x());
+            QCOMPARE(result.at(i).y(), expected.at(i).y());
+            QCOMPARE(columns.at(i).x(), expectedColumns.at(i).x());
+            QCOMPARE(columns.at(i).y(), expectedColumns.at(i).y());
+        }
+    }
+}
+
 QTEST_MAIN(tst_Domain)
 #include "tst_domain.moc"
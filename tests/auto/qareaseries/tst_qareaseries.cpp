@@ -31,6 +31,7 @@
 #include <QtGui/QImage>
 #include <QtCharts/QChartView>
 #include <QtCharts/QAreaSeries>
+#include <QtCharts/QAreaSeriesStack>
 #include <QtCharts/QLineSeries>
 #include <QtCharts/QChartView>
 #include <QtCharts/QValueAxis>
@@ -50,6 +51,8 @@ public slots:
 private slots:
     void areaSeries();
     void dynamicEdgeSeriesChange();
+    void stack();
+    void stackAppend();
 
 protected:
     QLineSeries *createUpperSeries();
@@ -178,6 +181,119 @@ QLineSeries *tst_QAreaSeries::createLowerSeries()
     return series;
 }
 
+void tst_QAreaSeries::stack()
+{
+    QAreaSeriesStack stack(3);
+    QCOMPARE(stack.bandCount(), 3);
+    QCOMPARE(stack.bands().count(), 3);
+    QCOMPARE(stack.count(), 0);
+
+    // Neighboring bands share their edge
+    QCOMPARE(stack.band(0)->lowerSeries(), stack.boundary(0));
+    QCOMPARE(stack.band(0)->upperSeries(), stack.boundary(1));
+    QCOMPARE(stack.band(1)->lowerSeries(), stack.boundary(1));
+    QCOMPARE(stack.band(2)->upperSeries(), stack.boundary(3));
+    QVERIFY(!stack.band(3));
+
+    stack.replace({ 0, 1, 2 }, { { 1, 2, 3 }, { 10, 20, 30 }, { 100, 200, 300 } });
+    QCOMPARE(stack.count(), 3);
+    QCOMPARE(stack.boundary(0)->points(), QList<QPointF>({ { 0, 0 }, { 1, 0 }, { 2, 0 } }));
+    QCOMPARE(stack.boundary(2)->points(), QList<QPointF>({ { 0, 11 }, { 1, 22 }, { 2, 33 } }));
+    QCOMPARE(stack.boundary(3)->at(2), QPointF(2, 333));
+
+    // Growing beyond the initial capacity keeps the previous rows
+    for (int i = 3; i < 200; ++i)
+        stack.append(i, { 1, 2, 3 });
+    stack.append({ 200, 201 }, { { 1, 1 }, { 1, 1 }, { 1, 1 } });
+    QCOMPARE(stack.count(), 202);
+    QCOMPARE(stack.boundary(3)->count(), 202);
+    QCOMPARE(stack.boundary(3)->at(1), QPointF(1, 222));
+    QCOMPARE(stack.boundary(3)->at(100), QPointF(100, 6));
+    QCOMPARE(stack.boundary(2)->at(201), QPointF(201, 2));
+
+    // Mismatching values are ignored
+    QTest::ignoreMessage(QtWarningMsg, "QAreaSeriesStack: Expected values for 3 bands, got 2");
+    stack.append(202, { 1, 2 });
+    QCOMPARE(stack.count(), 202);
+
+    m_chart->addSeries(stack.band(0));
+    m_chart->addSeries(stack.band(1));
+    m_view->show();
+    QVERIFY(QTest::qWaitForWindowExposed(m_view));
+
+    stack.clear();
+    QCOMPARE(stack.count(), 0);
+    QCOMPARE(stack.boundary(1)->count(), 0);
+}
+
+void tst_QAreaSeries::stackAppend()
+{
+    QList<qreal> x = { 0, 1 };
+    QList<QList<qreal>> values = { { 1, 2 }, { 3, 4 } };
+    QAreaSeriesStack stack(2);
+    stack.replace(x, values);
+    QAreaSeries *band = stack.band(1);
+    band->setBrush(m_brushColor);
+    m_chart->addSeries(band);
+    band->attachAxis(m_axisX);
+    band->attachAxis(m_axisY);
+    m_view->show();
+    QVERIFY(QTest::qWaitForWindowExposed(m_view));
+    const QImage before = m_view->grab().toImage();
+
+    QList<QSignalSpy *> addedSpies;
+    QList<QSignalSpy *> replacedSpies;
+    for (int i = 0; i <= stack.bandCount(); ++i) {
+        addedSpies.append(new QSignalSpy(stack.boundary(i), &QXYSeries::pointsAdded));
+        replacedSpies.append(new QSignalSpy(stack.boundary(i), &QXYSeries::pointsReplaced));
+    }
+
+    // Only the appended rows are reported to the boundaries
+    stack.append(2, { 2, 3 });
+    x.append(2);
+    values[0].append(2);
+    values[1].append(3);
+    for (int i = 0; i <= stack.bandCount(); ++i) {
+        QCOMPARE(addedSpies.at(i)->count(), 1);
+        QCOMPARE(addedSpies.at(i)->takeFirst(), QVariantList({ 2, 1 }));
+    }
+    QCOMPARE(stack.boundary(2)->at(2), QPointF(2, 5));
+
+    stack.append({ 3, 4 }, { { 1, 2 }, { 1, 1 } });
+    x.append({ 3, 4 });
+    values[0].append({ 1, 2 });
+    values[1].append({ 1, 1 });
+    for (int i = 0; i <= stack.bandCount(); ++i) {
+        QCOMPARE(addedSpies.at(i)->count(), 1);
+        QCOMPARE(addedSpies.at(i)->takeFirst(), QVariantList({ 3, 2 }));
+    }
+    QCOMPARE(stack.boundary(2)->at(4), QPointF(4, 3));
+
+    // Growing the buffer adopts the new one, but still only reports the new row
+    for (int i = 5; i < 100; ++i) {
+        stack.append(i, { 1, 1 });
+        x.append(i);
+        values[0].append(1);
+        values[1].append(1);
+        QCOMPARE(addedSpies.at(1)->count(), 1);
+        QCOMPARE(addedSpies.at(1)->takeFirst(), QVariantList({ i, 1 }));
+    }
+    QCOMPARE(stack.boundary(1)->count(), 100);
+    QCOMPARE(stack.boundary(2)->at(99), QPointF(99, 2));
+    for (int i = 0; i <= stack.bandCount(); ++i)
+        QCOMPARE(replacedSpies.at(i)->count(), 0);
+
+    // The geometry updated for the appended rows matches the geometry of the whole stack
+    const QImage appended = m_view->grab().toImage();
+    QVERIFY(appended != before);
+    stack.replace(x, values);
+    QCOMPARE(replacedSpies.at(2)->count(), 1);
+    QCOMPARE(m_view->grab().toImage(), appended);
+
+    qDeleteAll(addedSpies);
+    qDeleteAll(replacedSpies);
+}
+
 void tst_QAreaSeries::checkPixels(const QColor &upperColor,
                                   const QColor &centerColor,
                                   const QColor &lowerColor)
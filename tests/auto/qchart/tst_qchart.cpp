@@ -41,10 +41,42 @@
 #include <QtCharts/QValueAxis>
 #include <QtCharts/QBarCategoryAxis>
 #include <QtCharts/QDateTimeAxis>
+#include <private/abstractdomain_p.h>
+#include <private/chartdataset_p.h>
+#include <private/glxyseriesdata_p.h>
+#include <private/qabstractseries_p.h>
+#include <private/xychart_p.h>
 #include "tst_definitions.h"
 
 QT_USE_NAMESPACE
 
+// Gives the tests access to the geometry calculated for a line series
+class GeometryLineSeries : public QLineSeries
+{
+public:
+    using QLineSeries::QLineSeries;
+
+    XYChart *item() const { return static_cast<XYChart *>(d_ptr->chartItem()); }
+    QList<QPointF> geometry() const { return item()->geometryPoints(); }
+    GLXYSeriesData *glData() const
+    {
+        return item()->dataSet()->glXYSeriesDataManager()->dataMap().value(this);
+    }
+    int geometryOffset() const { return item()->geometryOffset(); }
+    quint64 revision() const { return item()->geometryRevision(); }
+
+    // The geometry of the points in the current domain, calculated right away
+    QList<QPointF> currentGeometry(int *offset = nullptr) const
+    {
+        int first = 0;
+        const QList<QPointF> geometry =
+                d_ptr->domain()->calculateVisibleGeometryPoints(points(), first);
+        if (offset)
+            *offset = first;
+        return geometry;
+    }
+};
+
 Q_DECLARE_METATYPE(QAbstractAxis *)
 Q_DECLARE_METATYPE(QValueAxis *)
 Q_DECLARE_METATYPE(QBarCategoryAxis *)
@@ -126,6 +158,11 @@ private slots:
     void zoomInAndOut_data();
     void zoomInAndOut();
     void fixedPlotArea();
+    void geometryThreadCount();
+    void openGLEviction();
+    void asynchronousGeometry();
+    void coalesceSeriesUpdates();
+    void visibleGeometry();
 private:
     void createTestData();
 
@@ -1229,6 +1266,299 @@ void tst_QChart::fixedPlotArea()
     QCOMPARE(m_chart->plotArea(), originalPlotArea);
 }
 
+void tst_QChart::geometryThreadCount()
+{
+    QVERIFY(m_chart->geometryThreadCount() >= 1);
+    m_chart->setGeometryThreadCount(4);
+    QCOMPARE(m_chart->geometryThreadCount(), 4);
+    m_chart->setGeometryThreadCount(0);
+    QCOMPARE(m_chart->geometryThreadCount(), 1);
+
+    // Enough points and series to be split into several chunks
+    m_chart->setGeometryThreadCount(4);
+    QList<GeometryLineSeries *> seriesList;
+    for (int i = 0; i < 4; ++i) {
+        GeometryLineSeries *series = new GeometryLineSeries(this);
+        QList<QPointF> points;
+        for (int j = 0; j < 50000; ++j)
+            points << QPointF(j, (j * (i + 1)) % 100);
+        series->replace(points);
+        m_chart->addSeries(series);
+        seriesList << series;
+    }
+    m_chart->createDefaultAxes();
+    m_view->show();
+    QVERIFY(QTest::qWaitForWindowExposed(m_view));
+
+    auto geometries = [&seriesList]() {
+        QList<QList<QPointF>> geometries;
+        for (GeometryLineSeries *series : qAsConst(seriesList))
+            geometries << series->geometry();
+        return geometries;
+    };
+    auto transformAll = [this]() {
+        m_chart->zoomReset();
+        m_chart->zoomIn();
+        m_chart->scroll(10, 0);
+    };
+
+    // The geometry calculated by several threads matches the geometry of a single thread
+    QAbstractAxis *axisX = m_chart->axes(Qt::Horizontal).value(0);
+    QVERIFY(axisX);
+    const qreal min = axisX->property("min").toReal();
+    transformAll();
+    const QList<QList<QPointF>> threaded = geometries();
+    for (GeometryLineSeries *series : qAsConst(seriesList)) {
+        QVERIFY(!series->geometry().isEmpty());
+        QCOMPARE(series->geometry(), series->currentGeometry());
+    }
+
+    m_chart->setGeometryThreadCount(1);
+    transformAll();
+    QCOMPARE(geometries(), threaded);
+
+    m_chart->setGeometryThreadCount(4);
+    m_chart->zoomReset();
+    QCOMPARE(axisX->property("min").toReal(), min);
+    for (GeometryLineSeries *series : qAsConst(seriesList))
+        QCOMPARE(series->geometry(), series->currentGeometry());
+}
+
+void tst_QChart::openGLEviction()
+{
+    SKIP_ON_POLAR();
+
+    GeometryLineSeries *series = new GeometryLineSeries(this);
+    series->setUseOpenGL(true);
+    series->setCapacity(100);
+    for (int i = 0; i < 100; ++i)
+        series->append(i, i % 10);
+    m_chart->addSeries(series);
+    m_chart->createDefaultAxes();
+    m_view->show();
+    QVERIFY(QTest::qWaitForWindowExposed(m_view));
+
+    GLXYSeriesData *data = series->glData();
+    QVERIFY(data);
+    QCOMPARE(data->array.size(), 200);
+
+    // As if the array had been uploaded
+    auto uploaded = [data]() {
+        data->dirty = false;
+        data->clearArrayDirty();
+    };
+
+    // Appending to the full series drops the oldest vertex from the front, and only the new
+    // vertex is marked dirty
+    uploaded();
+    series->append(100, 5);
+    QCOMPARE(series->count(), 100);
+    QVERIFY(data->dirty);
+    QCOMPARE(data->array.size(), 200);
+    QCOMPARE(data->arrayRemovedFront, 2);
+    QCOMPARE(data->arrayDirtyBegin, 198);
+    QCOMPARE(data->arrayDirtyEnd, 200);
+
+    uploaded();
+    QList<QPointF> points;
+    for (int i = 101; i < 106; ++i)
+        points << QPointF(i, i % 10);
+    series->append(points);
+    QCOMPARE(series->count(), 100);
+    QCOMPARE(data->array.size(), 200);
+    QCOMPARE(data->arrayRemovedFront, 10);
+    QCOMPARE(data->arrayDirtyBegin, 190);
+    QCOMPARE(data->arrayDirtyEnd, 200);
+
+    // The vertices are the points relative to the origin
+    for (int i = 0; i < series->count(); ++i) {
+        const QPointF point = series->at(i) - data->origin;
+        QCOMPARE(data->array.at(i * 2), float(point.x()));
+        QCOMPARE(data->array.at(i * 2 + 1), float(point.y()));
+    }
+}
+
+void tst_QChart::asynchronousGeometry()
+{
+    QCOMPARE(m_chart->isAsynchronousGeometry(), false);
+    m_chart->setAsynchronousGeometry(true);
+    QCOMPARE(m_chart->isAsynchronousGeometry(), true);
+
+    GeometryLineSeries *series = new GeometryLineSeries(this);
+    QList<QPointF> points;
+    for (int i = 0; i < 100000; ++i)
+        points << QPointF(i, i % 100);
+    series->replace(points);
+    m_chart->addSeries(series);
+    m_chart->createDefaultAxes();
+    m_view->show();
+    QVERIFY(QTest::qWaitForWindowExposed(m_view));
+    QTRY_COMPARE(series->geometry(), series->currentGeometry());
+
+    // The chart keeps its geometry until the build for the new domain is applied
+    quint64 revision = series->revision();
+    m_chart->zoomIn();
+    QCOMPARE(series->revision(), revision);
+    QTRY_VERIFY(series->revision() != revision);
+    QCOMPARE(series->geometry(), series->currentGeometry());
+
+    revision = series->revision();
+    m_chart->scroll(5, 0);
+    QCOMPARE(series->revision(), revision);
+    QTRY_VERIFY(series->revision() != revision);
+    QCOMPARE(series->geometry(), series->currentGeometry());
+
+    // Each of these supersedes the build started by the previous one. Whenever geometry is
+    // applied, it is the geometry of the newest domain and points.
+    for (int i = 0; i < 10; ++i) {
+        m_chart->scroll(5, 0);
+        series->append(100000 + i, 0);
+        revision = series->revision();
+        QCoreApplication::processEvents();
+        if (series->revision() != revision)
+            QCOMPARE(series->geometry(), series->currentGeometry());
+    }
+    QTRY_COMPARE(series->geometry(), series->currentGeometry());
+
+    // The geometry calculated asynchronously matches the geometry calculated synchronously
+    m_chart->zoomIn();
+    m_chart->scroll(-20, 0);
+    QTRY_COMPARE(series->geometry(), series->currentGeometry());
+    const QList<QPointF> asynchronous = series->geometry();
+    m_chart->setAsynchronousGeometry(false);
+    series->replace(series->points());
+    QCOMPARE(series->geometry(), asynchronous);
+
+    // Switching back finishes the build in progress right away
+    m_chart->setAsynchronousGeometry(true);
+    m_chart->scroll(5, 0);
+    QCoreApplication::processEvents();
+    m_chart->setAsynchronousGeometry(false);
+    QCOMPARE(m_chart->isAsynchronousGeometry(), false);
+    QCOMPARE(series->geometry(), series->currentGeometry());
+
+    // Deleting the chart while a build is running must be safe
+    m_chart->setAsynchronousGeometry(true);
+    m_chart->scroll(5, 0);
+    QCoreApplication::processEvents();
+}
+
+void tst_QChart::coalesceSeriesUpdates()
+{
+    QCOMPARE(m_chart->coalesceSeriesUpdates(), false);
+    m_chart->setCoalesceSeriesUpdates(true);
+    QCOMPARE(m_chart->coalesceSeriesUpdates(), true);
+
+    GeometryLineSeries *series = new GeometryLineSeries(this);
+    QList<QPointF> points;
+    for (int i = 0; i < 1000; ++i)
+        points << QPointF(i, i % 10);
+    series->append(points);
+    m_chart->addSeries(series);
+    m_chart->createDefaultAxes();
+    m_view->show();
+    QVERIFY(QTest::qWaitForWindowExposed(m_view));
+    QTRY_COMPARE(series->geometry(), series->currentGeometry());
+
+    // The replacements of one frame update the geometry once
+    quint64 revision = series->revision();
+    for (int i = 0; i < 1000; i += 3)
+        series->replace(i, QPointF(i, 5));
+    QCOMPARE(series->revision(), revision);
+    QTRY_VERIFY(series->revision() != revision);
+    QCOMPARE(series->revision(), revision + 1);
+    const QList<QPointF> coalesced = series->geometry();
+    QCOMPARE(coalesced, series->currentGeometry());
+
+    // The geometry is the same as when every replacement is updated on its own
+    m_chart->setCoalesceSeriesUpdates(false);
+    series->replace(points);
+    revision = series->revision();
+    for (int i = 0; i < 1000; i += 3)
+        series->replace(i, QPointF(i, 5));
+    QCOMPARE(series->revision(), revision + 334);
+    QCOMPARE(series->geometry(), coalesced);
+    m_chart->setCoalesceSeriesUpdates(true);
+
+    // Structural changes mixed with replacements
+    for (int i = 0; i < 100; ++i) {
+        series->replace(i, QPointF(i, 1));
+        series->append(1000 + i, 2);
+        series->remove(0);
+    }
+    QCOMPARE(series->count(), 1000);
+    QTRY_COMPARE(series->geometry(), series->currentGeometry());
+
+    // Switching off updates the pending changes right away
+    series->replace(10, QPointF(110, 3));
+    series->removePoints(0, 500);
+    m_chart->setCoalesceSeriesUpdates(false);
+    QCOMPARE(m_chart->coalesceSeriesUpdates(), false);
+    QCOMPARE(series->count(), 500);
+    QCOMPARE(series->geometry(), series->currentGeometry());
+
+    // Deleting the chart with changes pending must be safe
+    m_chart->setCoalesceSeriesUpdates(true);
+    series->replace(0, QPointF(500, 0));
+}
+
+void tst_QChart::visibleGeometry()
+{
+    SKIP_ON_POLAR();
+
+    GeometryLineSeries *series = new GeometryLineSeries(this);
+    QList<QPointF> points;
+    for (int i = 0; i < 100000; ++i)
+        points << QPointF(i, i % 100);
+    series->replace(points);
+    m_chart->addSeries(series);
+    m_chart->createDefaultAxes();
+    m_view->show();
+    QVERIFY(QTest::qWaitForWindowExposed(m_view));
+    QCOMPARE(series->geometry().count(), series->count());
+    QCOMPARE(series->geometryOffset(), 0);
+
+    // Zoomed in, the geometry only covers the visible points and their neighbours
+    m_chart->axes(Qt::Horizontal).value(0)->setRange(50000.5, 50010.5);
+    m_chart->axes(Qt::Vertical).value(0)->setRange(0, 100);
+    int offset = -1;
+    QCOMPARE(series->geometry(), series->currentGeometry(&offset));
+    QCOMPARE(offset, 50000);
+    QCOMPARE(series->geometryOffset(), offset);
+    QCOMPARE(series->geometry().count(), 12);
+    QCOMPARE(series->item()->offGridStatusVector().count(), 12);
+
+    // Changes to the series keep the geometry to the visible part
+    series->replace(50005, QPointF(50005, 50.37));
+    QCOMPARE(series->geometry(), series->currentGeometry(&offset));
+    QCOMPARE(series->geometryOffset(), 50000);
+    series->append(100000, 0);
+    QCOMPARE(series->geometry(), series->currentGeometry(&offset));
+    QCOMPARE(series->geometryOffset(), 50000);
+    series->remove(0);
+    QCOMPARE(series->geometry(), series->currentGeometry(&offset));
+    QCOMPARE(series->geometryOffset(), 49999);
+    QCOMPARE(series->geometry().count(), 12);
+
+    // The light markers belong to the series points at the offset
+    SKIP_IF_CANNOT_TEST_MOUSE_EVENTS();
+    QImage marker(10, 10, QImage::Format_ARGB32);
+    marker.fill(Qt::red);
+    series->setLightMarker(marker);
+    QSignalSpy spy(series, SIGNAL(pressed(QPointF)));
+    const QPointF position = m_chart->mapToPosition(QPointF(50005, 50.37), series);
+    QTest::mouseClick(m_view->viewport(), Qt::LeftButton, {}, position.toPoint());
+    QCoreApplication::processEvents(QEventLoop::AllEvents, 1000);
+    QCOMPARE(spy.count(), 1);
+    QCOMPARE(qvariant_cast<QPointF>(spy.takeFirst().at(0)), QPointF(50005, 50.37));
+
+    // Zooming out brings back the geometry of all the points
+    m_chart->axes(Qt::Horizontal).value(0)->setRange(-10, 100010);
+    QCOMPARE(series->geometry(), series->currentGeometry(&offset));
+    QCOMPARE(series->geometryOffset(), 0);
+    QCOMPARE(series->geometry().count(), series->count());
+}
+
 QTEST_MAIN(tst_QChart)
 #include "tst_qchart.moc"
 
@@ -48,6 +48,9 @@ private slots:
     void releasedSignal();
     void doubleClickedSignal();
     void insert();
+    void pressedSignalOffLine();
+    void pressedSignalDeepZoom();
+    void pressedLightMarker();
 protected:
     void pointsVisible_data();
 };
@@ -235,6 +238,141 @@ void tst_QLineSeries::doubleClickedSignal()
     QCOMPARE(qRound(signalPoint.y()), qRound(linePoint.y()));
 }
 
+void tst_QLineSeries::pressedSignalOffLine()
+{
+    SKIP_IF_CANNOT_TEST_MOUSE_EVENTS();
+
+    QLineSeries *lineSeries = new QLineSeries();
+    lineSeries->append(QPointF(0, 0));
+    lineSeries->append(QPointF(10, 10));
+    lineSeries->append(QPointF(20, 0));
+
+    QChartView view;
+    view.resize(200, 200);
+    view.chart()->legend()->setVisible(false);
+    view.chart()->addSeries(lineSeries);
+    view.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&view));
+
+    QSignalSpy seriesSpy(lineSeries, SIGNAL(pressed(QPointF)));
+
+    // Inside the bounding rect of the line, but far from its segments
+    QPointF checkPoint = view.chart()->mapToPosition(QPointF(10, 2));
+    QTest::mouseClick(view.viewport(), Qt::LeftButton, {}, checkPoint.toPoint());
+    QCoreApplication::processEvents(QEventLoop::AllEvents, 1000);
+    QCOMPARE(seriesSpy.count(), 0);
+
+    // Between the points, on the first segment
+    checkPoint = view.chart()->mapToPosition(QPointF(5, 5));
+    QTest::mouseClick(view.viewport(), Qt::LeftButton, {}, checkPoint.toPoint());
+    QCoreApplication::processEvents(QEventLoop::AllEvents, 1000);
+    QCOMPARE(seriesSpy.count(), 1);
+}
+
+void tst_QLineSeries::pressedSignalDeepZoom()
+{
+    SKIP_IF_CANNOT_TEST_MOUSE_EVENTS();
+
+    QLineSeries *lineSeries = new QLineSeries();
+    lineSeries->append(QPointF(0, 0));
+    lineSeries->append(QPointF(10, 10));
+
+    QChartView view;
+    view.resize(200, 200);
+    view.chart()->legend()->setVisible(false);
+    view.chart()->addSeries(lineSeries);
+    view.chart()->createDefaultAxes();
+    // The ends of the line are far beyond the int range in pixels
+    view.chart()->axes(Qt::Horizontal).first()->setRange(5 - 1e-9, 5 + 1e-9);
+    view.chart()->axes(Qt::Vertical).first()->setRange(5 - 1e-9, 5 + 1e-9);
+    view.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&view));
+
+    QSignalSpy seriesSpy(lineSeries, SIGNAL(pressed(QPointF)));
+
+    QPointF checkPoint = view.chart()->mapToPosition(QPointF(5, 5));
+    QTest::mouseClick(view.viewport(), Qt::LeftButton, {}, checkPoint.toPoint());
+    QCoreApplication::processEvents(QEventLoop::AllEvents, 1000);
+    QCOMPARE(seriesSpy.count(), 1);
+}
+
+// The light markers are matched through a grid of the geometry points, which is updated
+// incrementally when the series changes
+void tst_QLineSeries::pressedLightMarker()
+{
+    SKIP_IF_CANNOT_TEST_MOUSE_EVENTS();
+
+    QImage marker(10, 10, QImage::Format_ARGB32);
+    marker.fill(Qt::red);
+    QLineSeries *lineSeries = new QLineSeries();
+    lineSeries->setLightMarker(marker);
+    // Values off the pixel grid, so that only a matched marker reports them exactly
+    for (int i = 0; i < 10; ++i)
+        lineSeries->append(QPointF(i * 10 + 5.37, (i % 3) * 30 + 10.41));
+
+    QChartView view;
+    view.resize(400, 400);
+    view.chart()->legend()->setVisible(false);
+    view.chart()->addSeries(lineSeries);
+    view.chart()->createDefaultAxes();
+    view.chart()->axes(Qt::Horizontal).first()->setRange(0, 200);
+    view.chart()->axes(Qt::Vertical).first()->setRange(0, 100);
+    view.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&view));
+
+    QSignalSpy seriesSpy(lineSeries, SIGNAL(pressed(QPointF)));
+    auto press = [&view, &seriesSpy](const QPointF &point) {
+        seriesSpy.clear();
+        const QPointF checkPoint = view.chart()->mapToPosition(point);
+        QTest::mouseClick(view.viewport(), Qt::LeftButton, {}, checkPoint.toPoint());
+        QCoreApplication::processEvents(QEventLoop::AllEvents, 1000);
+        if (seriesSpy.isEmpty())
+            return QPointF(qQNaN(), qQNaN());
+        return qvariant_cast<QPointF>(seriesSpy.takeFirst().at(0));
+    };
+
+    QCOMPARE(press(lineSeries->at(3)), lineSeries->at(3));
+
+    // Appended points
+    lineSeries->append(QPointF(105.37, 70.41));
+    QCOMPARE(press(QPointF(105.37, 70.41)), QPointF(105.37, 70.41));
+    QCOMPARE(press(lineSeries->at(3)), lineSeries->at(3));
+
+    // Evicting the oldest points shifts the indexes of the remaining ones
+    lineSeries->setCapacity(11);
+    lineSeries->append(QPointF(115.37, 80.41));
+    QCOMPARE(lineSeries->count(), 11);
+    QCOMPARE(lineSeries->at(0), QPointF(15.37, 40.41));
+    QCOMPARE(press(QPointF(115.37, 80.41)), QPointF(115.37, 80.41));
+    QCOMPARE(press(lineSeries->at(0)), lineSeries->at(0));
+    QCOMPARE(press(lineSeries->at(5)), lineSeries->at(5));
+    QVERIFY(press(QPointF(5.37, 10.41)) != QPointF(5.37, 10.41));
+
+    QList<QPointF> points;
+    points << QPointF(125.37, 20.41) << QPointF(135.37, 50.41) << QPointF(145.37, 20.41);
+    lineSeries->append(points);
+    QCOMPARE(lineSeries->count(), 11);
+    QCOMPARE(press(QPointF(135.37, 50.41)), QPointF(135.37, 50.41));
+    QCOMPARE(press(lineSeries->at(2)), lineSeries->at(2));
+
+    // Removed points are not matched anymore
+    const QPointF removed = lineSeries->at(4);
+    lineSeries->remove(4);
+    QVERIFY(press(removed) != removed);
+    QCOMPARE(press(lineSeries->at(4)), lineSeries->at(4));
+
+    // Replaced points are matched at their new position only
+    const QPointF replaced = lineSeries->at(6);
+    lineSeries->replace(6, QPointF(92.37, 95.41));
+    QCOMPARE(press(QPointF(92.37, 95.41)), QPointF(92.37, 95.41));
+    QVERIFY(press(replaced) != replaced);
+
+    // A new domain rebuilds the grid
+    view.chart()->axes(Qt::Horizontal).first()->setRange(50, 150);
+    QCOMPARE(press(lineSeries->at(7)), lineSeries->at(7));
+    QCOMPARE(press(QPointF(92.37, 95.41)), QPointF(92.37, 95.41));
+}
+
 QTEST_MAIN(tst_QLineSeries)
 
 #include "tst_qlineseries.moc"
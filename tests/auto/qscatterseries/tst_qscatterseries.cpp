@@ -48,6 +48,7 @@ private slots:
     void pressedSignal();
     void releasedSignal();
     void doubleClickedSignal();
+    void batchedMarkerSignals();
 
 protected:
     void pointsVisible_data();
@@ -234,6 +235,53 @@ void tst_QScatterSeries::doubleClickedSignal()
     QCOMPARE(qRound(signalPoint.y()), qRound(scatterPoint.y()));
 }
 
+void tst_QScatterSeries::batchedMarkerSignals()
+{
+    SKIP_IF_CANNOT_TEST_MOUSE_EVENTS();
+
+    // Enough points for the markers to be painted in one batch instead of one item each
+    QPointF scatterPoint(1000, 100);
+    QScatterSeries *scatterSeries = new QScatterSeries();
+    QList<QPointF> points;
+    for (int i = 0; i < 2000; ++i)
+        points << QPointF(i, 0);
+    points[1000] = scatterPoint;
+    scatterSeries->replace(points);
+
+    QChartView view;
+    view.resize(400, 400);
+    view.chart()->legend()->setVisible(false);
+    view.chart()->addSeries(scatterSeries);
+    view.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&view));
+
+    QSignalSpy pressedSpy(scatterSeries, SIGNAL(pressed(QPointF)));
+    QSignalSpy releasedSpy(scatterSeries, SIGNAL(released(QPointF)));
+    QSignalSpy clickedSpy(scatterSeries, SIGNAL(clicked(QPointF)));
+    QSignalSpy doubleClickedSpy(scatterSeries, SIGNAL(doubleClicked(QPointF)));
+
+    QPointF checkPoint = view.chart()->mapToPosition(scatterPoint);
+    QTest::mouseClick(view.viewport(), Qt::LeftButton, {}, checkPoint.toPoint());
+    QCoreApplication::processEvents(QEventLoop::AllEvents, 1000);
+
+    QCOMPARE(pressedSpy.count(), 1);
+    QCOMPARE(releasedSpy.count(), 1);
+    QCOMPARE(clickedSpy.count(), 1);
+    QCOMPARE(qvariant_cast<QPointF>(clickedSpy.takeFirst().at(0)), scatterPoint);
+
+    QTest::mouseDClick(view.viewport(), Qt::LeftButton, {}, checkPoint.toPoint());
+    QCoreApplication::processEvents(QEventLoop::AllEvents, 1000);
+    QCOMPARE(doubleClickedSpy.count(), 1);
+    QCOMPARE(qvariant_cast<QPointF>(doubleClickedSpy.takeFirst().at(0)), scatterPoint);
+
+    // Clicking between the markers doesn't hit any of them
+    pressedSpy.clear();
+    checkPoint = view.chart()->mapToPosition(QPointF(500, 50));
+    QTest::mouseClick(view.viewport(), Qt::LeftButton, {}, checkPoint.toPoint());
+    QCoreApplication::processEvents(QEventLoop::AllEvents, 1000);
+    QCOMPARE(pressedSpy.count(), 0);
+}
+
 QTEST_MAIN(tst_QScatterSeries)
 
 #include "tst_qscatterseries.moc"
@@ -29,9 +29,18 @@
 
 #include "../qxyseries/tst_qxyseries.h"
 #include <QtCharts/QSplineSeries>
+#include <private/splinechartitem_p.h>
 
 Q_DECLARE_METATYPE(QList<QPointF>)
 
+// Exposes the control point solver of the spline item
+class SplineSolver : public SplineChartItem
+{
+public:
+    using SplineChartItem::SplineChartItem;
+    using SplineChartItem::calculateControlPoints;
+};
+
 class tst_QSplineSeries : public tst_QXYSeries
 {
     Q_OBJECT
@@ -47,6 +56,7 @@ private slots:
     void pressedSignal();
     void releasedSignal();
     void doubleClickedSignal();
+    void incrementalControlPoints();
 protected:
     void pointsVisible_data();
 };
@@ -204,6 +214,85 @@ void tst_QSplineSeries::doubleClickedSignal()
     QCOMPARE(qRound(signalPoint.x()), qRound(splinePoint.x()));
     QCOMPARE(qRound(signalPoint.y()), qRound(splinePoint.y()));
 }
+
+// The incremental solve stops propagating changes below the tolerance of the solver, so
+// the control points are compared with a slightly larger tolerance
+static bool fuzzyCompare(const QList<QPointF> &actual, const QList<QPointF> &expected)
+{
+    if (actual.count() != expected.count())
+        return false;
+    for (int i = 0; i < actual.count(); ++i) {
+        if (qAbs(actual.at(i).x() - expected.at(i).x()) > 1e-4
+                || qAbs(actual.at(i).y() - expected.at(i).y()) > 1e-4) {
+            qWarning() << "Control point" << i << "is" << actual.at(i) << "instead of"
+                       << expected.at(i);
+            return false;
+        }
+    }
+    return true;
+}
+
+void tst_QSplineSeries::incrementalControlPoints()
+{
+    QSplineSeries series;
+    SplineSolver incremental(&series, nullptr);
+    auto solve = [&series](const QList<QPointF> &points) {
+        SplineSolver full(&series, nullptr);
+        return full.calculateControlPoints(points);
+    };
+
+    QList<QPointF> points;
+    for (int i = 0; i < 200; ++i)
+        points.append(QPointF(i * 3, 100 * qSin(i * 0.3)));
+    QVERIFY(fuzzyCompare(incremental.calculateControlPoints(points), solve(points)));
+
+    // Unchanged points
+    QVERIFY(fuzzyCompare(incremental.calculateControlPoints(points), solve(points)));
+
+    // Appending single points and blocks
+    for (int i = 200; i < 250; ++i) {
+        points.append(QPointF(i * 3, 100 * qSin(i * 0.3)));
+        QVERIFY(fuzzyCompare(incremental.calculateControlPoints(points), solve(points)));
+    }
+    for (int i = 0; i < 20; ++i)
+        points.append(QPointF(750 + i, -50 + i));
+    QVERIFY(fuzzyCompare(incremental.calculateControlPoints(points), solve(points)));
+
+    // Inserting in the middle and at the front
+    points.insert(120, QPointF(361, 500));
+    QVERIFY(fuzzyCompare(incremental.calculateControlPoints(points), solve(points)));
+    points.insert(0, QPointF(-3, 0));
+    QVERIFY(fuzzyCompare(incremental.calculateControlPoints(points), solve(points)));
+
+    // Removing from the front, the middle and the back
+    for (int i = 0; i < 10; ++i) {
+        points.removeFirst();
+        QVERIFY(fuzzyCompare(incremental.calculateControlPoints(points), solve(points)));
+    }
+    points.remove(100, 5);
+    QVERIFY(fuzzyCompare(incremental.calculateControlPoints(points), solve(points)));
+    points.removeLast();
+    QVERIFY(fuzzyCompare(incremental.calculateControlPoints(points), solve(points)));
+
+    // Replacing single points, the last one, and a range
+    for (int i = 0; i < points.count(); i += 17) {
+        points[i].ry() += 25;
+        QVERIFY(fuzzyCompare(incremental.calculateControlPoints(points), solve(points)));
+    }
+    points.last() = QPointF(points.last().x(), 1000);
+    QVERIFY(fuzzyCompare(incremental.calculateControlPoints(points), solve(points)));
+    for (int i = 50; i < 60; ++i)
+        points[i].ry() = -points.at(i).y();
+    QVERIFY(fuzzyCompare(incremental.calculateControlPoints(points), solve(points)));
+
+    // Shrinking to the smallest spline and growing again
+    points = points.mid(0, 2);
+    QVERIFY(fuzzyCompare(incremental.calculateControlPoints(points), solve(points)));
+    points.append(QPointF(points.last().x() + 3, 7));
+    points.append(QPointF(points.last().x() + 3, -7));
+    QVERIFY(fuzzyCompare(incremental.calculateControlPoints(points), solve(points)));
+}
+
 QTEST_MAIN(tst_QSplineSeries)
 
 #include "tst_qsplineseries.moc"
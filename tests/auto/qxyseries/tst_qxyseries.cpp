@@ -28,6 +28,7 @@
 ****************************************************************************/
 
 #include "tst_qxyseries.h"
+#include <QtCharts/QLineSeries>
 
 Q_DECLARE_METATYPE(QList<QPointF>)
 
@@ -182,6 +183,38 @@ void tst_QXYSeries::pointLabelsClipping()
     QVERIFY(arguments.at(0).toBool() == true);
 }
 
+void tst_QXYSeries::pointLabelsRestyle()
+{
+    // No axes, so that only the point labels depend on the number formatting
+    m_series->append(QList<QPointF>() << QPointF(0.5, 1.5) << QPointF(1.5, 2.5)
+                                      << QPointF(2.5, 0.5));
+    m_series->setPointLabelsVisible(true);
+    m_series->setPointLabelsFormat(QLatin1String("@yPoint"));
+    m_chart->legend()->setVisible(false);
+    m_chart->addSeries(m_series);
+    m_view->show();
+    QVERIFY(QTest::qWaitForWindowExposed(m_view));
+    QTest::qWait(50);
+    const QImage labels = m_view->grab().toImage();
+
+    // Changing the format formats the labels again
+    m_series->setPointLabelsFormat(QLatin1String("@xPoint"));
+    QTest::qWait(50);
+    QVERIFY(m_view->grab().toImage() != labels);
+    m_series->setPointLabelsFormat(QLatin1String("@yPoint"));
+    QTest::qWait(50);
+    QCOMPARE(m_view->grab().toImage(), labels);
+
+    // So does changing the locale of the numbers
+    m_chart->setLocale(QLocale(QLocale::German, QLocale::Germany));
+    m_chart->setLocalizeNumbers(true);
+    QTest::qWait(50);
+    QVERIFY(m_view->grab().toImage() != labels);
+    m_chart->setLocalizeNumbers(false);
+    QTest::qWait(50);
+    QCOMPARE(m_view->grab().toImage(), labels);
+}
+
 void tst_QXYSeries::append_data()
 {
     QTest::addColumn< QList<QPointF> >("points");
@@ -206,9 +239,13 @@ void tst_QXYSeries::append_raw()
     QFETCH(QList<QPointF>, otherPoints);
     QSignalSpy spy0(m_series, SIGNAL(clicked(QPointF)));
     QSignalSpy addedSpy(m_series, SIGNAL(pointAdded(int)));
+    QSignalSpy blockAddedSpy(m_series, SIGNAL(pointsAdded(int,int)));
     m_series->append(points);
     TRY_COMPARE(spy0.count(), 0);
-    TRY_COMPARE(addedSpy.count(), points.count());
+    TRY_COMPARE(addedSpy.count(), 0);
+    TRY_COMPARE(blockAddedSpy.count(), 1);
+    QCOMPARE(blockAddedSpy.at(0).at(0).toInt(), 0);
+    QCOMPARE(blockAddedSpy.at(0).at(1).toInt(), points.count());
     QCOMPARE(m_series->points(), points);
 
     // Process events between appends
@@ -546,6 +583,265 @@ void tst_QXYSeries::insert()
     m_series->insert(m_series->count(), QPointF(6, 6));
     TRY_COMPARE(addedSpy.count(), 2);
     QCOMPARE(m_series->points().count(), points.count() + 2);
+
+    QSignalSpy blockAddedSpy(m_series, SIGNAL(pointsAdded(int,int)));
+    m_series->insert(1, points);
+    TRY_COMPARE(addedSpy.count(), 2);
+    TRY_COMPARE(blockAddedSpy.count(), 1);
+    QCOMPARE(blockAddedSpy.at(0).at(0).toInt(), 1);
+    QCOMPARE(blockAddedSpy.at(0).at(1).toInt(), points.count());
+    QCOMPARE(m_series->points().count(), 2 * points.count() + 2);
+    QCOMPARE(m_series->points().mid(1, points.count()), points);
+    QCOMPARE(m_series->at(0), QPointF(5, 5));
+    QCOMPARE(m_series->at(m_series->count() - 1), QPointF(6, 6));
+}
+
+void tst_QXYSeries::capacity_data()
+{
+    append_data();
+}
+
+void tst_QXYSeries::capacity()
+{
+    QFETCH(QList<QPointF>, points);
+    QFETCH(QList<QPointF>, otherPoints);
+
+    QSignalSpy capacitySpy(m_series, SIGNAL(capacityChanged(int)));
+    QSignalSpy removedSpy(m_series, SIGNAL(pointsRemoved(int,int)));
+    QCOMPARE(m_series->capacity(), 0);
+
+    m_series->setCapacity(points.count());
+    TRY_COMPARE(capacitySpy.count(), 1);
+    QCOMPARE(m_series->capacity(), points.count());
+
+    m_series->append(points);
+    TRY_COMPARE(removedSpy.count(), 0);
+    QCOMPARE(m_series->points(), points);
+
+    // Appending to a full series slides the window
+    m_series->append(otherPoints.first());
+    TRY_COMPARE(removedSpy.count(), 1);
+    QCOMPARE(m_series->count(), points.count());
+    QCOMPARE(m_series->at(0), points.at(1));
+    QCOMPARE(m_series->at(m_series->count() - 1), otherPoints.first());
+
+    // Only the newest points of a block are kept
+    m_series->append(otherPoints + otherPoints);
+    QCOMPARE(m_series->points(), otherPoints);
+
+    // Shrinking the capacity removes the oldest points right away
+    m_series->setCapacity(2);
+    TRY_COMPARE(capacitySpy.count(), 2);
+    QCOMPARE(m_series->points(), otherPoints.mid(otherPoints.count() - 2));
+
+    m_series->setCapacity(0);
+    m_series->append(points);
+    QCOMPARE(m_series->count(), points.count() + 2);
+}
+
+void tst_QXYSeries::capacity_chart()
+{
+    QList<QPointF> points;
+    for (int i = 0; i < 50; ++i)
+        points.append(QPointF(i, (i * 7) % 11));
+    m_series->setCapacity(20);
+    m_series->append(points.mid(0, 20));
+    m_chart->addSeries(m_series);
+    m_chart->createDefaultAxes();
+    m_chart->axes(Qt::Horizontal).first()->setRange(0, 50);
+    m_chart->axes(Qt::Vertical).first()->setRange(0, 11);
+    m_view->show();
+    QVERIFY(QTest::qWaitForWindowExposed(m_view));
+
+    QSignalSpy removedSpy(m_series, SIGNAL(pointsRemoved(int,int)));
+    QSignalSpy addedSpy(m_series, SIGNAL(pointAdded(int)));
+    QSignalSpy blockAddedSpy(m_series, SIGNAL(pointsAdded(int,int)));
+
+    // The evicted and added points are still reported separately
+    for (int i = 20; i < 40; ++i)
+        m_series->append(points.at(i));
+    m_series->append(points.mid(40, 5));
+    QCOMPARE(removedSpy.count(), 21);
+    QCOMPARE(removedSpy.last(), QVariantList({ 0, 5 }));
+    QCOMPARE(addedSpy.count(), 20);
+    QCOMPARE(blockAddedSpy.count(), 1);
+    QCOMPARE(blockAddedSpy.first(), QVariantList({ 15, 5 }));
+    QCOMPARE(m_series->points(), points.mid(25, 20));
+
+    // The geometry slid along with the window matches the geometry of the same points
+    const QImage slid = m_view->grab().toImage();
+    m_series->replace(points.mid(25, 20));
+    QCOMPARE(m_view->grab().toImage(), slid);
+
+    // Inserting into a full series evicts as well
+    m_series->insert(10, QPointF(34.5, 5));
+    QCOMPARE(m_series->count(), 20);
+    QCOMPARE(m_series->at(0), points.at(26));
+    QCOMPARE(m_series->at(9), QPointF(34.5, 5));
+}
+
+void tst_QXYSeries::bounds()
+{
+    auto compareRanges = [this](qreal minX, qreal maxX, qreal minY, qreal maxY) {
+        m_chart->addSeries(m_series);
+        m_chart->createDefaultAxes();
+        QValueAxis *axisX = qobject_cast<QValueAxis *>(m_chart->axes(Qt::Horizontal).first());
+        QValueAxis *axisY = qobject_cast<QValueAxis *>(m_chart->axes(Qt::Vertical).first());
+        QVERIFY(axisX);
+        QVERIFY(axisY);
+        QCOMPARE(axisX->min(), minX);
+        QCOMPARE(axisX->max(), maxX);
+        QCOMPARE(axisY->min(), minY);
+        QCOMPARE(axisY->max(), maxY);
+        m_chart->removeSeries(m_series);
+    };
+
+    m_series->append(QList<QPointF>() << QPointF(0, 5) << QPointF(1, -3) << QPointF(2, 8)
+                                      << QPointF(3, 1));
+    compareRanges(0, 3, -3, 8);
+
+    m_series->append(4, 10);
+    m_series->insert(0, QPointF(-1, 2));
+    compareRanges(-1, 4, -3, 10);
+
+    // Removing or replacing points that define the bounds must shrink them
+    m_series->remove(0);
+    m_series->replace(4, QPointF(4, 0));
+    compareRanges(0, 4, -3, 8);
+
+    m_series->removePoints(1, 2);
+    compareRanges(0, 4, 0, 5);
+
+    m_series->replace(QList<QPointF>() << QPointF(10, 10) << QPointF(20, 30));
+    compareRanges(10, 20, 10, 30);
+
+    m_series->clear();
+    m_series->append(7, 7);
+    m_series->append(9, 6);
+    compareRanges(7, 9, 6, 7);
+}
+
+void tst_QXYSeries::fitToVisiblePoints()
+{
+    SKIP_ON_POLAR();
+
+    // Rises up to x = 500 and falls after it
+    QList<QPointF> points;
+    for (int i = 0; i <= 1000; ++i)
+        points << QPointF(i, i < 500 ? i : 1000 - i);
+    m_series->append(points);
+    m_chart->addSeries(m_series);
+    m_chart->createDefaultAxes();
+    m_view->show();
+    QVERIFY(QTest::qWaitForWindowExposed(m_view));
+
+    QValueAxis *axisX = qobject_cast<QValueAxis *>(m_chart->axes(Qt::Horizontal).first());
+    QValueAxis *axisY = qobject_cast<QValueAxis *>(m_chart->axes(Qt::Vertical).first());
+    QVERIFY(axisX);
+    QVERIFY(axisY);
+
+    auto compareVisibleRangeY = [&]() {
+        qreal minY = qInf();
+        qreal maxY = -qInf();
+        for (const QPointF &point : qAsConst(points)) {
+            if (point.x() >= axisX->min() && point.x() <= axisX->max()) {
+                minY = qMin(minY, point.y());
+                maxY = qMax(maxY, point.y());
+            }
+        }
+        QCOMPARE(axisY->min(), minY);
+        QCOMPARE(axisY->max(), maxY);
+    };
+
+    QSignalSpy fitSpy(axisY, SIGNAL(fitToVisiblePointsChanged(bool)));
+    axisY->setFitToVisiblePoints(true);
+    QCOMPARE(fitSpy.count(), 1);
+    QVERIFY(axisY->fitToVisiblePoints());
+
+    axisX->setRange(0, 100);
+    const qreal plotWidth = m_chart->plotArea().width();
+    m_chart->scroll(plotWidth, 0);
+    compareVisibleRangeY();
+
+    m_chart->scroll(plotWidth * 3.5, 0);
+    compareVisibleRangeY();
+
+    const QRectF plotArea = m_chart->plotArea();
+    m_chart->zoomIn(QRectF(plotArea.left(), plotArea.top(), plotArea.width() / 4,
+                           plotArea.height()));
+    compareVisibleRangeY();
+
+    // Without fitting only the horizontal range changes
+    axisY->setFitToVisiblePoints(false);
+    QCOMPARE(fitSpy.count(), 2);
+    const qreal minY = axisY->min();
+    const qreal maxY = axisY->max();
+    m_chart->scroll(plotWidth, 0);
+    QCOMPARE(axisY->min(), minY);
+    QCOMPARE(axisY->max(), maxY);
+}
+
+void tst_QXYSeries::fitToVisiblePointsSharedAxis()
+{
+    SKIP_ON_POLAR();
+
+    // The series have their own domains, but share the fitted axis. The first one rises
+    // and the second one falls ten times as steeply.
+    QList<QPointF> points;
+    QList<QPointF> otherPoints;
+    for (int i = 0; i <= 1000; ++i) {
+        points << QPointF(i, i);
+        otherPoints << QPointF(i, -10 * i);
+    }
+    m_series->append(points);
+    QLineSeries *other = new QLineSeries;
+    other->append(otherPoints);
+    m_chart->addSeries(m_series);
+    m_chart->addSeries(other);
+    m_chart->createDefaultAxes();
+    m_view->show();
+    QVERIFY(QTest::qWaitForWindowExposed(m_view));
+
+    QValueAxis *axisX = qobject_cast<QValueAxis *>(m_chart->axes(Qt::Horizontal).first());
+    QValueAxis *axisY = qobject_cast<QValueAxis *>(m_chart->axes(Qt::Vertical).first());
+    QVERIFY(axisX);
+    QVERIFY(axisY);
+    QCOMPARE(m_chart->axes(Qt::Vertical, other).first(), axisY);
+
+    auto compareVisibleRangeY = [&]() {
+        qreal minY = qInf();
+        qreal maxY = -qInf();
+        for (const QList<QPointF> &list : { points, otherPoints }) {
+            for (const QPointF &point : list) {
+                if (point.x() >= axisX->min() && point.x() <= axisX->max()) {
+                    minY = qMin(minY, point.y());
+                    maxY = qMax(maxY, point.y());
+                }
+            }
+        }
+        QCOMPARE(axisY->min(), minY);
+        QCOMPARE(axisY->max(), maxY);
+        // Both of the series are mapped with the fitted range
+        const QPointF value((axisX->min() + axisX->max()) / 2, (minY + maxY) / 2);
+        QCOMPARE(m_chart->mapToPosition(value, other), m_chart->mapToPosition(value, m_series));
+    };
+
+    axisY->setFitToVisiblePoints(true);
+    axisX->setRange(0, 100);
+    const qreal plotWidth = m_chart->plotArea().width();
+    m_chart->scroll(plotWidth, 0);
+    compareVisibleRangeY();
+
+    m_chart->scroll(plotWidth * 2.5, 0);
+    compareVisibleRangeY();
+
+    const QRectF plotArea = m_chart->plotArea();
+    m_chart->zoomIn(QRectF(plotArea.left(), plotArea.top(), plotArea.width() / 4,
+                           plotArea.height()));
+    compareVisibleRangeY();
+
+    m_chart->zoomOut();
+    compareVisibleRangeY();
 }
 
 void tst_QXYSeries::oper_data()
@@ -621,6 +917,123 @@ void tst_QXYSeries::pointsVisible_raw()
     QCOMPARE(m_series->pointsVisible(), pointsVisible);
 }
 
+void tst_QXYSeries::producer()
+{
+    QXYSeriesProducer null;
+    QVERIFY(null.isNull());
+    null.append(1, 1);
+
+    QXYSeriesProducer producer = m_series->producer();
+    QVERIFY(!producer.isNull());
+    QSignalSpy addedSpy(m_series, SIGNAL(pointsAdded(int,int)));
+    QSignalSpy replacedSpy(m_series, SIGNAL(pointsReplaced()));
+
+    // Several threads feed the series at the same time. More points than fit into the
+    // ring of a thread are queued, and single points are mixed with blocks.
+    const int threadCount = 4;
+    const int pointCount = 5000;
+    QList<QThread *> threads;
+    for (int t = 0; t < threadCount; ++t) {
+        threads << QThread::create([producer, t]() mutable {
+            for (int i = 0; i < pointCount; ++i) {
+                if (i % 100 == 0)
+                    producer.append(QList<QPointF>() << QPointF(t, i));
+                else
+                    producer.append(t, i);
+            }
+        });
+        threads.last()->start();
+    }
+    for (QThread *thread : qAsConst(threads)) {
+        QVERIFY(thread->wait());
+        delete thread;
+    }
+
+    QTRY_COMPARE(m_series->count(), threadCount * pointCount);
+    QVERIFY(addedSpy.count() < threadCount * pointCount);
+    QCOMPARE(replacedSpy.count(), 0);
+
+    // The points of each thread keep their order
+    QList<int> next(threadCount, 0);
+    for (const QPointF &point : m_series->points()) {
+        const int t = int(point.x());
+        QCOMPARE(int(point.y()), next[t]++);
+    }
+
+    // A replacement drops the points queued before it
+    producer.append(QList<QPointF>() << QPointF(10, 10) << QPointF(11, 11));
+    producer.replace(QList<QPointF>() << QPointF(1, 1) << QPointF(2, 2));
+    producer.append(QPointF(3, 3));
+    QTRY_COMPARE(replacedSpy.count(), 1);
+    QCOMPARE(m_series->points(), QList<QPointF>() << QPointF(1, 1) << QPointF(2, 2) << QPointF(3, 3));
+}
+
+void tst_QXYSeries::adoptColumns()
+{
+    const qreal x[] = { 0, 1, 2, 3 };
+    const qreal y[] = { 5, -1, 7, 2 };
+    int released = 0;
+    QSignalSpy replacedSpy(m_series, SIGNAL(pointsReplaced()));
+
+    m_series->adoptColumns(x, y, 4, [&released]() { ++released; });
+    QCOMPARE(replacedSpy.count(), 1);
+    QCOMPARE(m_series->count(), 4);
+    QCOMPARE(m_series->at(2), QPointF(2, 7));
+    QCOMPARE(m_series->points(), QList<QPointF>() << QPointF(0, 5) << QPointF(1, -1)
+                                                  << QPointF(2, 7) << QPointF(3, 2));
+    QCOMPARE(released, 0);
+
+    // Adopting new columns releases the previous ones
+    m_series->adoptColumns(x, y, 2, [&released]() { released += 10; });
+    QCOMPARE(released, 1);
+    QCOMPARE(m_series->count(), 2);
+
+    // Modifying the series copies the columns and releases them
+    m_series->append(4, 4);
+    QCOMPARE(released, 11);
+    QCOMPARE(m_series->points(), QList<QPointF>() << QPointF(0, 5) << QPointF(1, -1)
+                                                  << QPointF(4, 4));
+
+    m_series->adoptColumns(x, y, 4, [&released]() { ++released; });
+    m_series->clear();
+    QCOMPARE(released, 12);
+    QCOMPARE(m_series->count(), 0);
+
+    // Columns larger than the capacity keep the newest points
+    m_series->setCapacity(3);
+    m_series->adoptColumns(x, y, 4);
+    QCOMPARE(m_series->points(), QList<QPointF>() << QPointF(1, -1) << QPointF(2, 7)
+                                                  << QPointF(3, 2));
+    m_series->setCapacity(0);
+
+    // Shrinking the capacity trims the columns without releasing them
+    released = 0;
+    QSignalSpy removedSpy(m_series, SIGNAL(pointsRemoved(int,int)));
+    m_series->adoptColumns(x, y, 4, [&released]() { ++released; });
+    m_series->setCapacity(2);
+    QCOMPARE(removedSpy.count(), 1);
+    QCOMPARE(removedSpy.first(), QVariantList({ 0, 2 }));
+    QCOMPARE(m_series->count(), 2);
+    QCOMPARE(m_series->at(0), QPointF(2, 7));
+    QCOMPARE(m_series->points(), QList<QPointF>() << QPointF(2, 7) << QPointF(3, 2));
+    QCOMPARE(released, 0);
+    m_series->setCapacity(1);
+    QCOMPARE(m_series->points(), QList<QPointF>() << QPointF(3, 2));
+    QCOMPARE(released, 0);
+    m_series->clear();
+    QCOMPARE(released, 1);
+    m_series->setCapacity(0);
+
+    // The geometry is calculated from the columns
+    m_chart->addSeries(m_series);
+    m_chart->createDefaultAxes();
+    m_view->show();
+    QVERIFY(QTest::qWaitForWindowExposed(m_view));
+    m_series->adoptColumns(x, y, 4);
+    m_chart->zoomIn();
+    QCOMPARE(m_series->count(), 4);
+}
+
 void tst_QXYSeries::changedSignals()
 {
     QSignalSpy visibleSpy(m_series, SIGNAL(visibleChanged()));
@@ -33,6 +33,8 @@
 #include <QtTest/QtTest>
 #include <QtCharts/QXYSeries>
 #include <QtCharts/QChartView>
+#include <QtCharts/QValueAxis>
+#include <QtCharts/QXYSeriesProducer>
 #include <QtGui/QStandardItemModel>
 #include <tst_definitions.h>
 
@@ -56,6 +58,7 @@ private slots:
     void pointLabelsFont();
     void pointLabelsColor();
     void pointLabelsClipping();
+    void pointLabelsRestyle();
     void seriesOpacity();
     void oper_data();
     void oper();
@@ -93,6 +96,14 @@ private slots:
     void replace_chart_animation();
     void insert_data();
     void insert();
+    void capacity_data();
+    void capacity();
+    void capacity_chart();
+    void bounds();
+    void fitToVisiblePoints();
+    void fitToVisiblePointsSharedAxis();
+    void producer();
+    void adoptColumns();
     void changedSignals();
 protected:
     void append_data();
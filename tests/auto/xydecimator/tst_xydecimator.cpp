@@ -0,0 +1,266 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+#include <QtTest/QtTest>
+#include <QtCharts/private/xydecimator_p.h>
+#include <QtCharts/private/xydomain_p.h>
+#include <tst_definitions.h>
+
+QT_USE_NAMESPACE
+
+class tst_XYDecimator : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void decimate_data();
+    void decimate();
+    void minMax_data();
+    void minMax();
+    void minMaxOrder();
+    void largestTriangleThreeBuckets_data();
+    void largestTriangleThreeBuckets();
+    void largestTriangleThreeBucketsSpike();
+    void decimateClipped_data();
+    void decimateClipped();
+
+private:
+    static QList<QPointF> noise(int count, qreal width);
+};
+
+// Deterministic saw-tooth like data spread over the given width in pixels
+QList<QPointF> tst_XYDecimator::noise(int count, qreal width)
+{
+    QList<QPointF> points;
+    for (int i = 0; i < count; ++i)
+        points.append(QPointF(width * i / count, (i * 7919) % 101));
+    return points;
+}
+
+void tst_XYDecimator::decimate_data()
+{
+    QTest::addColumn<int>("mode");
+    QTest::addColumn<int>("count");
+    QTest::addColumn<bool>("reduced");
+    QTest::newRow("none, many points") << int(QXYSeries::DecimationMode::NoDecimation)
+                                       << 10000 << false;
+    QTest::newRow("minmax, few points") << int(QXYSeries::DecimationMode::MinMax) << 150 << false;
+    QTest::newRow("minmax, many points") << int(QXYSeries::DecimationMode::MinMax)
+                                         << 10000 << true;
+    QTest::newRow("lttb, few points")
+            << int(QXYSeries::DecimationMode::LargestTriangleThreeBuckets) << 200 << false;
+    QTest::newRow("lttb, many points")
+            << int(QXYSeries::DecimationMode::LargestTriangleThreeBuckets) << 10000 << true;
+}
+
+void tst_XYDecimator::decimate()
+{
+    QFETCH(int, mode);
+    QFETCH(int, count);
+    QFETCH(bool, reduced);
+
+    const QList<QPointF> points = noise(count, 100);
+    const QList<QPointF> result =
+            XYDecimator::decimate(points, QXYSeries::DecimationMode(mode), 100);
+
+    if (reduced) {
+        QVERIFY(result.count() < points.count());
+        QVERIFY(result.count() <= 400);
+        QCOMPARE(result.first(), points.first());
+        QCOMPARE(result.last(), points.last());
+    } else {
+        QCOMPARE(result, points);
+    }
+}
+
+void tst_XYDecimator::minMax_data()
+{
+    QTest::addColumn<int>("count");
+    QTest::addColumn<qreal>("width");
+    QTest::newRow("10 per column") << 1000 << qreal(100);
+    QTest::newRow("1000 per column") << 100000 << qreal(100);
+    QTest::newRow("fractional width") << 5000 << qreal(33.5);
+}
+
+void tst_XYDecimator::minMax()
+{
+    QFETCH(int, count);
+    QFETCH(qreal, width);
+
+    const QList<QPointF> points = noise(count, width);
+    const QList<QPointF> result = XYDecimator::minMax(points);
+
+    QVERIFY(result.count() <= 4 * qCeil(width));
+    QCOMPARE(result.first(), points.first());
+    QCOMPARE(result.last(), points.last());
+
+    // Every pixel column must keep its vertical extent
+    QMap<int, QPair<qreal, qreal>> expected;
+    for (const QPointF &point : points) {
+        const int column = qFloor(point.x());
+        auto it = expected.find(column);
+        if (it == expected.end())
+            expected.insert(column, qMakePair(point.y(), point.y()));
+        else
+            *it = qMakePair(qMin(it->first, point.y()), qMax(it->second, point.y()));
+    }
+    QMap<int, QPair<qreal, qreal>> actual;
+    for (const QPointF &point : result) {
+        const int column = qFloor(point.x());
+        auto it = actual.find(column);
+        if (it == actual.end())
+            actual.insert(column, qMakePair(point.y(), point.y()));
+        else
+            *it = qMakePair(qMin(it->first, point.y()), qMax(it->second, point.y()));
+    }
+    QCOMPARE(actual, expected);
+}
+
+void tst_XYDecimator::minMaxOrder()
+{
+    // Maximum comes before minimum within the column, both must be kept in that order
+    QList<QPointF> points;
+    points << QPointF(0.1, 5) << QPointF(0.2, 9) << QPointF(0.3, 5) << QPointF(0.4, 1)
+           << QPointF(0.5, 5) << QPointF(1.5, 3);
+
+    const QList<QPointF> expected = { QPointF(0.1, 5), QPointF(0.2, 9), QPointF(0.4, 1),
+                                      QPointF(0.5, 5), QPointF(1.5, 3) };
+    QCOMPARE(XYDecimator::minMax(points), expected);
+}
+
+void tst_XYDecimator::largestTriangleThreeBuckets_data()
+{
+    QTest::addColumn<int>("count");
+    QTest::addColumn<int>("threshold");
+    QTest::newRow("1000 -> 100") << 1000 << 100;
+    QTest::newRow("1001 -> 3") << 1001 << 3;
+    QTest::newRow("50 -> 49") << 50 << 49;
+    QTest::newRow("threshold above count") << 50 << 60;
+    QTest::newRow("threshold too small") << 50 << 2;
+}
+
+void tst_XYDecimator::largestTriangleThreeBuckets()
+{
+    QFETCH(int, count);
+    QFETCH(int, threshold);
+
+    const QList<QPointF> points = noise(count, 100);
+    const QList<QPointF> result = XYDecimator::largestTriangleThreeBuckets(points, threshold);
+
+    if (threshold < 3 || threshold >= count) {
+        QCOMPARE(result, points);
+        return;
+    }
+
+    QCOMPARE(result.count(), threshold);
+    QCOMPARE(result.first(), points.first());
+    QCOMPARE(result.last(), points.last());
+    for (int i = 1; i < result.count(); ++i)
+        QVERIFY(result.at(i - 1).x() < result.at(i).x());
+}
+
+void tst_XYDecimator::largestTriangleThreeBucketsSpike()
+{
+    // A single outlier on otherwise flat data is the most significant point of its bucket
+    QList<QPointF> points;
+    for (int i = 0; i < 1000; ++i)
+        points.append(QPointF(i, i == 517 ? 100 : 0));
+
+    const QList<QPointF> result = XYDecimator::largestTriangleThreeBuckets(points, 20);
+    QVERIFY(result.contains(QPointF(517, 100)));
+}
+
+void tst_XYDecimator::decimateClipped_data()
+{
+    QTest::addColumn<int>("mode");
+    QTest::addColumn<int>("maxPerColumn");
+    QTest::addColumn<bool>("budgeted");
+    QTest::newRow("minmax") << int(QXYSeries::DecimationMode::MinMax) << 4 << false;
+    QTest::newRow("lttb") << int(QXYSeries::DecimationMode::LargestTriangleThreeBuckets) << 2
+                          << true;
+}
+
+void tst_XYDecimator::decimateClipped()
+{
+    QFETCH(int, mode);
+    QFETCH(int, maxPerColumn);
+    QFETCH(bool, budgeted);
+
+    // A domain zoomed in to 1% of the series, with 20 points per pixel column visible
+    QList<QPointF> points;
+    for (int i = 0; i < 1000000; ++i)
+        points.append(QPointF(i, (i * 7919) % 101));
+    XYDomain domain;
+    domain.setSize(QSizeF(500, 100));
+    domain.setRange(495000, 505000, 0, 100);
+    const QList<QPointF> geometry = domain.calculateGeometryPoints(points);
+    // With a margin, like the line is clipped with
+    const QRectF clipRect = QRectF(QPointF(0, 0), domain.size()).adjusted(-2, -2, 2, 2);
+
+    const QList<QPolygonF> polylines =
+            XYDecimator::decimateClipped(geometry, QXYSeries::DecimationMode(mode), clipRect);
+    QCOMPARE(polylines.count(), 1);
+    const QPolygonF &polyline = polylines.first();
+
+    // The visible part gets the budget of the whole clip width
+    QVERIFY(polyline.count() > 500);
+    QVERIFY(polyline.count() <= maxPerColumn * (qCeil(clipRect.width()) + 1));
+    QVERIFY(qAbs(polyline.first().x() - clipRect.left()) < 0.1);
+    QVERIFY(qAbs(polyline.last().x() - clipRect.right()) < 0.1);
+    const QRectF bounds = clipRect.adjusted(-0.01, -0.01, 0.01, 0.01);
+    for (const QPointF &point : polyline)
+        QVERIFY(bounds.contains(point));
+
+    // Decimating the whole series to the plot width first leaves only a fraction of the
+    // budget for the visible part
+    if (budgeted) {
+        const QList<QPointF> decimated =
+                XYDecimator::decimate(geometry, QXYSeries::DecimationMode(mode), 500);
+        int visible = 0;
+        for (const QPointF &point : decimated) {
+            if (clipRect.contains(point))
+                ++visible;
+        }
+        QVERIFY(visible < polyline.count() / 10);
+    }
+
+    // Without decimation the visible part is only clipped
+    int inside = 0;
+    for (const QPointF &point : geometry) {
+        if (clipRect.contains(point))
+            ++inside;
+    }
+    const QList<QPolygonF> clipped = XYDecimator::decimateClipped(
+            geometry, QXYSeries::DecimationMode::NoDecimation, clipRect);
+    QCOMPARE(clipped.count(), 1);
+    QVERIFY(clipped.first().count() >= inside);
+    QVERIFY(clipped.first().count() <= inside + 2);
+}
+
+QTEST_MAIN(tst_XYDecimator)
+#include "tst_xydecimator.moc"
@@ -0,0 +1,170 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+#include <QtTest/QtTest>
+#include <QtCharts/private/xypointlabels_p.h>
+#include <tst_definitions.h>
+
+QT_USE_NAMESPACE
+
+class tst_XYPointLabels : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void cache();
+    void cacheStyle_data();
+    void cacheStyle();
+    void maxLabelWidth_data();
+    void maxLabelWidth();
+    void grid();
+};
+
+void tst_XYPointLabels::cache()
+{
+    XYPointLabelCache cache;
+    cache.setStyle(QLatin1String("@xPoint, @yPoint"), QFont(), QLocale::c(), false);
+    QStaticText label;
+    QVERIFY(!cache.find(QPointF(1, 2), label));
+    QCOMPARE(cache.insert(QPointF(1, 2), QLatin1String("1, 2")).text(), QLatin1String("1, 2"));
+    QVERIFY(cache.find(QPointF(1, 2), label));
+    QCOMPARE(label.text(), QLatin1String("1, 2"));
+    QVERIFY(!cache.find(QPointF(2, 1), label));
+
+    // The same style keeps the labels
+    cache.setStyle(QLatin1String("@xPoint, @yPoint"), QFont(), QLocale::c(), false);
+    QVERIFY(cache.find(QPointF(1, 2), label));
+
+    // The cache is dropped once it is much larger than the series
+    for (int i = 0; i < 100; ++i)
+        cache.insert(QPointF(i, i), QString::number(i));
+    cache.trim(100);
+    QCOMPARE(cache.count(), 101);
+    cache.trim(10);
+    QCOMPARE(cache.count(), 0);
+}
+
+void tst_XYPointLabels::cacheStyle_data()
+{
+    QTest::addColumn<QString>("format");
+    QTest::addColumn<QFont>("font");
+    QTest::addColumn<QLocale>("locale");
+    QTest::addColumn<bool>("localizeNumbers");
+
+    QFont bold;
+    bold.setBold(true);
+    const QString format(QLatin1String("@xPoint, @yPoint"));
+    QTest::newRow("format") << QString(QLatin1String("@yPoint")) << QFont() << QLocale::c()
+                            << false;
+    QTest::newRow("font") << format << bold << QLocale::c() << false;
+    QTest::newRow("locale") << format << QFont() << QLocale(QLocale::German, QLocale::Germany)
+                            << false;
+    QTest::newRow("localize numbers") << format << QFont() << QLocale::c() << true;
+}
+
+// Any change that affects the text or the layout of the labels drops them, so that they are
+// formatted again
+void tst_XYPointLabels::cacheStyle()
+{
+    QFETCH(QString, format);
+    QFETCH(QFont, font);
+    QFETCH(QLocale, locale);
+    QFETCH(bool, localizeNumbers);
+
+    XYPointLabelCache cache;
+    cache.setStyle(QLatin1String("@xPoint, @yPoint"), QFont(), QLocale::c(), false);
+    cache.insert(QPointF(1.5, 2), QLatin1String("1.5, 2"));
+    QStaticText label;
+    QVERIFY(cache.find(QPointF(1.5, 2), label));
+
+    cache.setStyle(format, font, locale, localizeNumbers);
+    QVERIFY(!cache.find(QPointF(1.5, 2), label));
+    QCOMPARE(cache.count(), 0);
+}
+
+void tst_XYPointLabels::maxLabelWidth_data()
+{
+    QTest::addColumn<QString>("format");
+    QTest::addColumn<QLocale>("locale");
+
+    QTest::newRow("default") << QString(QLatin1String("@xPoint, @yPoint")) << QLocale::c();
+    QTest::newRow("text") << QString(QLatin1String("Point at @yPoint mm")) << QLocale::c();
+    QTest::newRow("german") << QString(QLatin1String("@xPoint; @yPoint"))
+                            << QLocale(QLocale::German, QLocale::Germany);
+    QTest::newRow("arabic") << QString(QLatin1String("@xPoint, @yPoint"))
+                            << QLocale(QLocale::Arabic, QLocale::Egypt);
+}
+
+// Points are skipped by the bound, so it must not be less than the width of any label
+void tst_XYPointLabels::maxLabelWidth()
+{
+    QFETCH(QString, format);
+    QFETCH(QLocale, locale);
+
+    XYPointLabelCache cache;
+    QFont font;
+    font.setPixelSize(14);
+    cache.setStyle(format, font, locale, true);
+    QVERIFY(cache.maxLabelWidth() > 0);
+
+    const QList<qreal> values = { 0, 1.5, -123456, 1234567, -1.23456789e-300, -1.23456789e+308,
+                                  qInf(), qQNaN() };
+    for (qreal x : values) {
+        for (qreal y : values) {
+            QString text = format;
+            text.replace(QLatin1String("@xPoint"), locale.toString(x, 'g', 6));
+            text.replace(QLatin1String("@yPoint"), locale.toString(y, 'g', 6));
+            const QStaticText label = cache.insert(QPointF(x, y), text);
+            QVERIFY2(label.size().width() <= cache.maxLabelWidth(), qPrintable(text));
+        }
+    }
+}
+
+void tst_XYPointLabels::grid()
+{
+    XYPointLabelGrid grid(10);
+    QVERIFY(grid.place(QRectF(0, 0, 30, 10)));
+
+    // Labels overlapping a placed label are dropped, and are not placed themselves
+    QVERIFY(!grid.place(QRectF(20, 5, 30, 10)));
+    QVERIFY(!grid.place(QRectF(-10, -5, 15, 10)));
+    QVERIFY(grid.place(QRectF(35, 5, 30, 10)));
+    QVERIFY(grid.place(QRectF(31, 20, 4, 10)));
+
+    // Labels spanning many cells
+    QVERIFY(!grid.place(QRectF(-100, 8, 500, 4)));
+    QVERIFY(grid.place(QRectF(-100, 40, 500, 4)));
+    QVERIFY(!grid.place(QRectF(200, 42, 1, 1)));
+
+    // Labels far from the others and at the limits of the grid
+    QVERIFY(grid.place(QRectF(1e12, 1e12, 30, 10)));
+    QVERIFY(grid.place(QRectF(-1e12, -1e12, 30, 10)));
+}
+
+QTEST_MAIN(tst_XYPointLabels)
+#include "tst_xypointlabels.moc"
@@ -0,0 +1,238 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QtCharts/private/domaintransforms_p.h>
+#include <QtCharts/private/xydomain_p.h>
+#include <QtCharts/private/logxlogydomain_p.h>
+#include <QtCharts/private/xypolardomain_p.h>
+
+QT_USE_NAMESPACE
+
+Q_DECLARE_METATYPE(DomainTransforms::Kernel)
+
+class tst_Bench_DomainTransforms : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void cleanup();
+    void perPoint_data() { data(false); }
+    void perPoint();
+    void legacyBulk_data();
+    void legacyBulk();
+    void bulk_data() { data(true); }
+    void bulk();
+    void scale_data();
+    void scale();
+
+private:
+    void data(bool kernels);
+    QList<int> counts() const;
+    AbstractDomain *createDomain(const QString &type) const;
+    QList<QPointF> createPoints(int count) const;
+};
+
+static const struct {
+    DomainTransforms::Kernel kernel;
+    const char *name;
+} kernels[] = {
+    { DomainTransforms::ScalarKernel, "scalar" },
+    { DomainTransforms::Sse2Kernel, "sse2" },
+    { DomainTransforms::Avx2Kernel, "avx2" }
+};
+
+void tst_Bench_DomainTransforms::cleanup()
+{
+    DomainTransforms::setKernel(DomainTransforms::AutomaticKernel);
+}
+
+// 100M points need several gigabytes of memory
+QList<int> tst_Bench_DomainTransforms::counts() const
+{
+    QList<int> counts = { 1000000, 10000000 };
+    if (qEnvironmentVariableIsSet("QTCHARTS_BENCHMARK_HUGE"))
+        counts << 100000000;
+    return counts;
+}
+
+void tst_Bench_DomainTransforms::data(bool withKernels)
+{
+    QTest::addColumn<QString>("type");
+    QTest::addColumn<DomainTransforms::Kernel>("kernel");
+    QTest::addColumn<int>("count");
+    for (const char *type : { "xy", "logxlogy", "xypolar" }) {
+        for (int count : counts()) {
+            const QByteArray name = QByteArray(type) + ' ' + QByteArray::number(count);
+            if (!withKernels) {
+                QTest::newRow(name.constData())
+                        << QString::fromLatin1(type) << DomainTransforms::AutomaticKernel << count;
+                continue;
+            }
+            for (const auto &kernel : kernels) {
+                QTest::newRow((name + ' ' + kernel.name).constData())
+                        << QString::fromLatin1(type) << kernel.kernel << count;
+            }
+        }
+    }
+}
+
+AbstractDomain *tst_Bench_DomainTransforms::createDomain(const QString &type) const
+{
+    AbstractDomain *domain = nullptr;
+    if (type == QLatin1String("xy"))
+        domain = new XYDomain;
+    else if (type == QLatin1String("logxlogy"))
+        domain = new LogXLogYDomain;
+    else
+        domain = new XYPolarDomain;
+    domain->setRange(1, 1000, 1, 1000);
+    domain->setSize(QSizeF(1000, 1000));
+    return domain;
+}
+
+QList<QPointF> tst_Bench_DomainTransforms::createPoints(int count) const
+{
+    QList<QPointF> points;
+    points.reserve(count);
+    for (int i = 0; i < count; ++i)
+        points << QPointF(1 + (i % 999), 1 + ((i * 7) % 999));
+    return points;
+}
+
+// A virtual call per point, as when single points are transformed
+void tst_Bench_DomainTransforms::perPoint()
+{
+    QFETCH(QString, type);
+    QFETCH(int, count);
+
+    QScopedPointer<AbstractDomain> domain(createDomain(type));
+    const QList<QPointF> points = createPoints(count);
+    QList<QPointF> result(count);
+
+    QBENCHMARK {
+        bool ok;
+        for (int i = 0; i < count; ++i)
+            result[i] = domain->calculateGeometryPoint(points.at(i), ok);
+    }
+}
+
+void tst_Bench_DomainTransforms::legacyBulk_data()
+{
+    QTest::addColumn<int>("count");
+    for (int count : counts())
+        QTest::newRow(QByteArray::number(count).constData()) << count;
+}
+
+// The loop XYDomain::calculateGeometryPoints() used before the transforms were vectorized,
+// with the reverse checks inside of it
+void tst_Bench_DomainTransforms::legacyBulk()
+{
+    QFETCH(int, count);
+
+    QScopedPointer<AbstractDomain> domain(createDomain(QLatin1String("xy")));
+    const QList<QPointF> points = createPoints(count);
+    QList<QPointF> result;
+
+    QBENCHMARK {
+        const qreal minX = domain->minX();
+        const qreal minY = domain->minY();
+        const QSizeF size = domain->size();
+        const qreal deltaX = size.width() / (domain->maxX() - minX);
+        const qreal deltaY = size.height() / (domain->maxY() - minY);
+        const bool reverseX = domain->isReverseX();
+        const bool reverseY = domain->isReverseY();
+
+        result.resize(points.count());
+        for (int i = 0; i < points.count(); ++i) {
+            qreal x = (points[i].x() - minX) * deltaX;
+            if (reverseX)
+                x = size.width() - x;
+            qreal y = (points[i].y() - minY) * deltaY;
+            if (!reverseY)
+                y = size.height() - y;
+            result[i].setX(x);
+            result[i].setY(y);
+        }
+    }
+    QCOMPARE(result.count(), count);
+}
+
+void tst_Bench_DomainTransforms::bulk()
+{
+    QFETCH(QString, type);
+    QFETCH(DomainTransforms::Kernel, kernel);
+    QFETCH(int, count);
+
+    if (!DomainTransforms::setKernel(kernel))
+        QSKIP("The kernel is not supported by this CPU or build");
+    QScopedPointer<AbstractDomain> domain(createDomain(type));
+    const QList<QPointF> points = createPoints(count);
+    QList<QPointF> result;
+
+    QBENCHMARK {
+        result = domain->calculateGeometryPoints(points);
+    }
+    QCOMPARE(result.count(), count);
+}
+
+void tst_Bench_DomainTransforms::scale_data()
+{
+    QTest::addColumn<DomainTransforms::Kernel>("kernel");
+    QTest::addColumn<int>("count");
+    for (int count : counts()) {
+        for (const auto &kernel : kernels) {
+            const QByteArray name = QByteArray(kernel.name) + ' ' + QByteArray::number(count);
+            QTest::newRow(name.constData()) << kernel.kernel << count;
+        }
+    }
+}
+
+// The affine kernel alone, in place, without the allocation of the result
+void tst_Bench_DomainTransforms::scale()
+{
+    QFETCH(DomainTransforms::Kernel, kernel);
+    QFETCH(int, count);
+
+    if (!DomainTransforms::setKernel(kernel))
+        QSKIP("The kernel is not supported by this CPU or build");
+    QList<QPointF> points = createPoints(count);
+    const QList<QPointF> expected = points;
+    QPointF *data = points.data();
+
+    // Scaling by one keeps the values, so that every iteration does the same work
+    QBENCHMARK {
+        DomainTransforms::scale(data, count, QPointF(1, 1), 1.0, 1.0, QPointF(1, 1));
+    }
+    QCOMPARE(points, expected);
+}
+
+QTEST_MAIN(tst_Bench_DomainTransforms)
+
+#include "tst_bench_domaintransforms.moc"
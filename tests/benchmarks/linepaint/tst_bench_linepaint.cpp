@@ -0,0 +1,122 @@
+/****************************************************************************
+**
+** Copyright (C) 2021 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QtCore/QRandomGenerator>
+#include <QtGui/QImage>
+#include <QtGui/QPainter>
+#include <QtGui/QPainterPath>
+#include <QtCharts/private/linechartitem_p.h>
+
+QT_USE_NAMESPACE
+
+class tst_Bench_LinePaint : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void path_data() { data(); }
+    void path();
+    void polyline_data() { data(); }
+    void polyline();
+
+private:
+    void data();
+    QList<QPointF> createPoints(int count) const;
+};
+
+void tst_Bench_LinePaint::data()
+{
+    QTest::addColumn<int>("count");
+    QTest::addColumn<int>("penWidth");
+    for (int count : { 100000, 1000000 }) {
+        for (int penWidth : { 1, 3 }) {
+            const QByteArray name = QByteArray::number(count) + " width "
+                    + QByteArray::number(penWidth);
+            QTest::newRow(name.constData()) << count << penWidth;
+        }
+    }
+}
+
+// A random walk across the image, like a long sampled signal
+QList<QPointF> tst_Bench_LinePaint::createPoints(int count) const
+{
+    QList<QPointF> points;
+    points.reserve(count);
+    QRandomGenerator random(42);
+    qreal y = 500;
+    for (int i = 0; i < count; ++i) {
+        y = qBound(0.0, y + random.bounded(20.0) - 10.0, 1000.0);
+        points << QPointF(1000.0 * i / count, y);
+    }
+    return points;
+}
+
+// The way the line chart items painted cartesian lines before, through a path
+void tst_Bench_LinePaint::path()
+{
+    QFETCH(int, count);
+    QFETCH(int, penWidth);
+
+    const QList<QPointF> points = createPoints(count);
+    QImage image(1000, 1000, QImage::Format_ARGB32_Premultiplied);
+    image.fill(Qt::white);
+    QPainter painter(&image);
+    painter.setRenderHint(QPainter::Antialiasing);
+    painter.setPen(QPen(Qt::blue, penWidth));
+
+    QBENCHMARK {
+        QPainterPath linePath;
+        linePath.moveTo(points.at(0));
+        for (int i = 1; i < points.size(); ++i)
+            linePath.lineTo(points.at(i));
+        painter.drawPath(linePath);
+    }
+}
+
+void tst_Bench_LinePaint::polyline()
+{
+    QFETCH(int, count);
+    QFETCH(int, penWidth);
+
+    const QList<QPointF> points = createPoints(count);
+    QImage image(1000, 1000, QImage::Format_ARGB32_Premultiplied);
+    image.fill(Qt::white);
+    QPainter painter(&image);
+    painter.setRenderHint(QPainter::Antialiasing);
+    painter.setPen(QPen(Qt::blue, penWidth));
+
+    QBENCHMARK {
+        LineChartItem::drawPolyline(&painter, points.constData(), points.size());
+    }
+}
+
+QTEST_MAIN(tst_Bench_LinePaint)
+
+#include "tst_bench_linepaint.moc"
@@ -2,6 +2,7 @@ TEMPLATE = subdirs
 SUBDIRS += \
     presenterchart \
     polarcharttest \
+    polarbenchmark \
     boxplottester \
     candlesticktester \
     barcharttester
@@ -0,0 +1,109 @@
+/****************************************************************************
+**
+** Copyright (C) 2021 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+// Measures how long it takes to update the geometry of a polar line series. The points
+// are replaced on every frame, which transforms them and rebuilds the paths of the line.
+// The point count can be given as the first argument.
+
+#include <QtCharts/QChartView>
+#include <QtCharts/QLineSeries>
+#include <QtCharts/QPolarChart>
+#include <QtCharts/QValueAxis>
+#include <QtCore/QDebug>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QTimer>
+#include <QtCore/QtMath>
+#include <QtWidgets/QApplication>
+
+QT_USE_NAMESPACE
+
+static QList<QPointF> spiral(int count, qreal phase)
+{
+    // The spiral winds around several times, so that many segments cross the zero angle
+    // and are split between the left and the right paths
+    QList<QPointF> points;
+    points.reserve(count);
+    const int turns = 20;
+    for (int i = 0; i < count; ++i) {
+        const qreal t = qreal(i) / count;
+        const qreal angle = std::fmod(t * turns * 360.0 + phase, 360.0);
+        points.append(QPointF(angle, t + 0.05 * qSin(t * 1000.0 + phase)));
+    }
+    return points;
+}
+
+int main(int argc, char *argv[])
+{
+    QApplication a(argc, argv);
+
+    int count = 100000;
+    if (argc > 1)
+        count = qMax(2, QByteArray(argv[1]).toInt());
+
+    QPolarChart *chart = new QPolarChart;
+    chart->legend()->hide();
+    QLineSeries *series = new QLineSeries;
+    series->replace(spiral(count, 0));
+    chart->addSeries(series);
+
+    QValueAxis *angularAxis = new QValueAxis;
+    angularAxis->setRange(0, 360);
+    chart->addAxis(angularAxis, QPolarChart::PolarOrientationAngular);
+    series->attachAxis(angularAxis);
+    QValueAxis *radialAxis = new QValueAxis;
+    radialAxis->setRange(0, 1.1);
+    chart->addAxis(radialAxis, QPolarChart::PolarOrientationRadial);
+    series->attachAxis(radialAxis);
+
+    QChartView view(chart);
+    view.resize(800, 800);
+    view.show();
+
+    const int framesPerReport = 50;
+    int frame = 0;
+    qint64 elapsed = 0;
+    QTimer timer;
+    QObject::connect(&timer, &QTimer::timeout, [&]() {
+        const QList<QPointF> points = spiral(count, frame);
+        QElapsedTimer updateTimer;
+        updateTimer.start();
+        series->replace(points);
+        elapsed += updateTimer.nsecsElapsed();
+        if (++frame % framesPerReport == 0) {
+            const QString report = QStringLiteral("%1 points: %2 ms per update")
+                    .arg(count).arg(elapsed / 1e6 / framesPerReport, 0, 'f', 2);
+            qDebug().noquote() << report;
+            view.setWindowTitle(report);
+            elapsed = 0;
+        }
+    });
+    timer.start(0);
+
+    return a.exec();
+}
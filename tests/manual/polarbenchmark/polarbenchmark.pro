@@ -0,0 +1,7 @@
+include( ../../tests.pri )
+QT       += core gui widgets
+
+TARGET = polarbenchmark
+TEMPLATE = app
+
+SOURCES += main.cpp